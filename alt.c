@@ -15,7 +15,72 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "alt.h"
+#include "dwt.h"
+#include "frame_budget.h"
+#include "led_flush.h"
+#include "led_indicator.h"
+#include "idle_power.h"
+#include "sr_shadow.h"
+#include "task_sched.h"
+#ifdef LATENCY_STATS_ENABLE
+#include "latency.h"
+#endif
 
-/* Temporary solution for matrix delay */
-void matrix_output_select_delay(void) { matrix_io_delay(); }
-void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+static TASK_SCHED_TASK(idle_power_sched, "idle power", idle_power_task, 100, 100, 20);
+#ifdef BINLOG_ENABLE
+static TASK_SCHED_TASK(binlog_sched, "binlog", binlog_task, 0, 5, 300);
+#endif
+
+void matrix_init_kb(void) {
+    dwt_init();
+    sr_shadow_init();
+    task_sched_add(&idle_power_sched);
+#ifdef BINLOG_ENABLE
+    task_sched_add(&binlog_sched);
+#endif
+    matrix_init_user();
+}
+
+void matrix_scan_kb(void) {
+#ifdef LATENCY_STATS_ENABLE
+    latency_scan();
+#endif
+    matrix_scan_user();
+}
+
+bool process_record_kb(uint16_t keycode, keyrecord_t *record) {
+    //Reactive effects change the frames from here on
+    led_flush_wake();
+    return process_record_user(keycode, record);
+}
+
+bool led_update_kb(led_t led_state) {
+    led_indicator_locks(led_state);
+    return led_update_user(led_state);
+}
+
+layer_state_t layer_state_set_kb(layer_state_t state) {
+    state = layer_state_set_user(state);
+    led_indicator_layers(state | default_layer_state);
+    return state;
+}
+
+layer_state_t default_layer_state_set_kb(layer_state_t state) {
+    state = default_layer_state_set_user(state);
+    led_indicator_layers(layer_state | state);
+    return state;
+}
+
+void housekeeping_task_kb(void) {
+#ifdef LATENCY_STATS_ENABLE
+    latency_report();
+#endif
+    //Counts every loop iteration, so it stays out of the scheduler
+    frame_budget_task();
+    task_sched_run();
+    housekeeping_task_user();
+    //Starts the next changed LED register run once the last one is off the bus
+    led_flush_task();
+    //Everything this pass changed on the shift register goes out as one write
+    sr_shadow_flush();
+}
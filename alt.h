@@ -3,6 +3,7 @@
 #include "quantum.h"
 #include "config_led.h"
 #include "matrix.h"
+#include "binlog.h"
 
 #include "i2c_master.h"
 #include "md_rgb_matrix.h" //For led keycodes
@@ -25,12 +26,20 @@
 
 #define TOGGLE_FLAG_AND_PRINT(var, name) { \
         if (var) { \
-            dprintf(name " disabled\r\n"); \
+            LOG_DPRINTF(name " disabled\r\n"); \
             var = !var; \
         } else { \
             var = !var; \
-            dprintf(name " enabled\r\n"); \
+            LOG_DPRINTF(name " enabled\r\n"); \
         } \
     }
 
+#ifdef RGB_MATRIX_ENABLE
+// Derived LED layout tables, see config_led.c
+extern const uint8_t led_polar_angle[DRIVER_LED_TOTAL];
+extern const uint8_t led_polar_radius[DRIVER_LED_TOTAL];
+extern const uint8_t led_row_band[DRIVER_LED_TOTAL];
+extern const uint8_t led_col_band[DRIVER_LED_TOTAL];
+#endif
+
 #define LAYOUT LAYOUT_65_ansi_blocker // Ensure that user made existing keymaps do not break. 
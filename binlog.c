@@ -0,0 +1,96 @@
+#include "binlog.h"
+
+#include <stdarg.h>
+#include <string.h>
+#include "quantum.h"
+#include "sendchar.h"
+#include "dwt.h"
+
+#define BINLOG_ADDRESS_MASK         0x00FFFFFF  //Flash is far below 16 MB, the top byte holds the argument count
+#define BINLOG_DROPPED              0           //Format address of the record reporting lost ones
+
+_Static_assert((BINLOG_WORDS & (BINLOG_WORDS - 1)) == 0 && BINLOG_WORDS <= 0x8000, "BINLOG_WORDS must be a power of two up to 32768");
+
+binlog_stats_t binlog_stats;
+
+static uint32_t ring[BINLOG_WORDS];
+//Free running word counts, head only moved by binlog_write and tail only by binlog_task
+static volatile uint16_t head;
+static volatile uint16_t tail;
+static uint32_t dropped;
+
+static void put(uint16_t *at, uint32_t word) {
+    ring[(*at)++ % BINLOG_WORDS] = word;
+}
+
+//A record is a header word (argument count and format address), the cycle count and the arguments
+void binlog_write(const char *fmt, uint8_t nargs, ...) {
+    uint16_t at = head;
+    uint16_t used = at - tail;
+    va_list args;
+
+    if (BINLOG_WORDS - used < nargs + 2U) {
+        dropped++;
+        binlog_stats.dropped++;
+        return;
+    }
+
+    put(&at, (uint32_t)nargs << 24 | ((uint32_t)fmt & BINLOG_ADDRESS_MASK));
+    put(&at, dwt_cycles());
+    va_start(args, nargs);
+    for (uint8_t i = 0; i < nargs; i++) {
+        put(&at, va_arg(args, uint32_t));
+    }
+    va_end(args);
+
+    //The record has to be in the ring before the reader can see it
+    __asm__ volatile("" ::: "memory");
+    head = at;
+
+    binlog_stats.records++;
+    if ((uint16_t)(at - tail) > binlog_stats.peak_words) {
+        binlog_stats.peak_words = at - tail;
+    }
+}
+
+static void send_word(uint32_t word) {
+    for (int8_t shift = 28; shift >= 0; shift -= 4) {
+        sendchar("0123456789ABCDEF"[(word >> shift) & 0xF]);
+    }
+}
+
+void binlog_task(void) {
+    uint16_t at = tail;
+    uint8_t words;
+
+    if (at == head) {
+        //Reported once the ring has drained, so the count lands after the records that made it
+        if (dropped) {
+            sendchar(BINLOG_MARK);
+            send_word((uint32_t)1 << 24 | BINLOG_DROPPED);
+            send_word(dwt_cycles());
+            send_word(dropped);
+            sendchar('\n');
+            dropped = 0;
+        }
+        return;
+    }
+
+    words = (ring[at % BINLOG_WORDS] >> 24) + 2;
+    sendchar(BINLOG_MARK);
+    for (uint8_t i = 0; i < words; i++) {
+        send_word(ring[at++ % BINLOG_WORDS]);
+    }
+    sendchar('\n');
+
+    __asm__ volatile("" ::: "memory");
+    tail = at;
+}
+
+void binlog_print(void) {
+#ifdef CONSOLE_ENABLE
+    uprintf("Binary log: records %lu dropped %lu, peak %u of %u words\n",
+        binlog_stats.records, binlog_stats.dropped, binlog_stats.peak_words, BINLOG_WORDS);
+#endif
+    memset(&binlog_stats, 0, sizeof(binlog_stats));
+}
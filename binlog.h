@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+//Opt-in deferred logging (BINLOG_ENABLE in rules.mk, needs CONSOLE_ENABLE)
+//LOG_PRINTF stores the address of its format string, a cycle count and the raw arguments in a RAM ring
+//instead of formatting on the device. The main loop sends one record per iteration over the console as a
+//hex line, and binlog_decode.py formats it on the host from the firmware ELF.
+//Arguments are passed as 32-bit words, so no 64-bit or float arguments, and %s only for strings in flash.
+#ifndef BINLOG_WORDS
+#define BINLOG_WORDS                256         //Ring size in 32-bit words, a power of two
+#endif
+#define BINLOG_ARGS_MAX             6
+#define BINLOG_MARK                 '~'         //Starts a record line in the console output
+
+#ifdef BINLOG_ENABLE
+#define BINLOG_NARGS(...)           BINLOG_NARGS_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define BINLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, n, ...) n
+
+#define LOG_PRINTF(fmt, ...)        binlog_write(fmt, BINLOG_NARGS(__VA_ARGS__), ##__VA_ARGS__)
+#define LOG_DPRINTF(fmt, ...)       do { if (debug_enable) LOG_PRINTF(fmt, ##__VA_ARGS__); } while (0)
+
+typedef struct {
+    uint32_t records;       //Records written
+    uint32_t dropped;       //Records lost to a full ring
+    uint16_t peak_words;    //Most words waiting at once
+} binlog_stats_t;
+
+extern binlog_stats_t binlog_stats;
+
+//Queues a record, from the main loop only (the ring has a single writer and a single reader)
+void binlog_write(const char *fmt, uint8_t nargs, ...);
+//Sends the oldest waiting record, call from the main loop
+void binlog_task(void);
+//Prints the ring counters over the console and clears them
+void binlog_print(void);
+#else
+#define LOG_PRINTF(...)             uprintf(__VA_ARGS__)
+#define LOG_DPRINTF(...)            dprintf(__VA_ARGS__)
+#endif
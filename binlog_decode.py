@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""Decode the binary log records in console output (see binlog.h).
+
+Each record line is BINLOG_MARK followed by hex words: the argument count
+and format string address, the DWT cycle count and the raw arguments. The
+format string is read from the firmware ELF at that address and applied on
+the host. Every other console line is passed through unchanged.
+
+    qmk console | ./binlog_decode.py [--elf ~/qmk_firmware/.build/massdrop_alt_mbednarek360.elf]
+    ./binlog_decode.py capture.txt
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+# Matching binlog.h and binlog.c
+MARK = "~"
+ADDRESS_MASK = 0x00FFFFFF
+DROPPED = 0
+# Matching dwt.h
+CPU_HZ = 120000000
+
+SHT_PROGBITS = 1
+SHF_ALLOC = 0x2
+
+RECORD_RE = re.compile(re.escape(MARK) + r"((?:[0-9A-F]{8}){2,})")
+SPEC_RE = re.compile(r"%([-+ 0#]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|t)?([diuxXcsp%])")
+
+
+class Elf:
+    """Loaded sections of a 32-bit little endian ELF, enough to read strings by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            sys.exit(path + " is not a 32-bit little endian ELF")
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            _, kind, flags, addr, offset, size = struct.unpack_from("<IIIIII", data, shoff + i * shentsize)
+            if kind == SHT_PROGBITS and flags & SHF_ALLOC and size:
+                self.sections.append((addr, data[offset:offset + size]))
+
+    def string(self, address):
+        for start, body in self.sections:
+            if start <= address < start + len(body):
+                end = body.find(b"\0", address - start)
+                return body[address - start:end if end >= 0 else None].decode("utf-8", "replace")
+        return None
+
+
+def format_record(elf, fmt, args):
+    args = list(args)
+
+    def convert(m):
+        flags, width, precision, _, conv = m.groups()
+        if conv == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        if conv in "di":
+            value -= (value & 0x80000000) << 1
+            conv = "d"
+        elif conv == "u":
+            conv = "d"
+        elif conv == "c":
+            value = chr(value & 0xFF)
+        elif conv == "s":
+            text = elf.string(value)
+            value = text if text is not None else "<0x{:08X}>".format(value)
+        elif conv == "p":
+            value, conv = "0x{:08X}".format(value), "s"
+        spec = "%" + flags + width + ("." + precision if precision else "") + conv
+        return spec % value
+
+    return SPEC_RE.sub(convert, fmt)
+
+
+def decode(elf, stream, out):
+    last = None
+    for line in stream:
+        m = RECORD_RE.search(line)
+        if not m:
+            out.write(line)
+            continue
+        words = [int(m[1][i:i + 8], 16) for i in range(0, len(m[1]), 8)]
+        header, cycles, args = words[0], words[1], words[2:]
+        address = header & ADDRESS_MASK
+
+        delta = "" if last is None else "+{} us".format(((cycles - last) & 0xFFFFFFFF) * 1000000 // CPU_HZ)
+        last = cycles
+        if address == DROPPED:
+            text = "({} records dropped)".format(args[0] if args else "?")
+        else:
+            fmt = elf.string(address)
+            text = format_record(elf, fmt, args) if fmt is not None else "(no string at 0x{:06X})".format(address)
+        out.write("[{:>12}] {}\n".format(delta, text.rstrip("\r\n")))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("capture", nargs="?", help="console output, stdin when left out")
+    parser.add_argument("--elf", default="~/qmk_firmware/.build/massdrop_alt_mbednarek360.elf")
+    args = parser.parse_args()
+
+    elf = Elf(os.path.expanduser(args.elf))
+    if args.capture:
+        with open(args.capture) as stream:
+            decode(elf, stream, sys.stdout)
+    else:
+        decode(elf, sys.stdin, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
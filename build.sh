@@ -1,5 +1,11 @@
 #!/bin/sh
 
+./gen_led_config.py || exit 1
+./gen_led_anim.py || exit 1
+./keymaps/mbednarek360/gen_unicode_map.py || exit 1
+before=$(wc -c < firmware.bin 2>/dev/null || echo 0)
 cp -rf . ~/qmk_firmware/keyboards/massdrop/alt/
-qmk compile -kb massdrop/alt -km mbednarek360 -c
+qmk compile -kb massdrop/alt -km mbednarek360 -c || exit 1
 mv ~/qmk_firmware/massdrop_alt_mbednarek360.bin firmware.bin
+after=$(wc -c < firmware.bin)
+echo "firmware.bin: $before -> $after bytes ($((after - before)))"
@@ -126,8 +126,23 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //#define NO_ACTION_MACRO
 //#define NO_ACTION_FUNCTION
 
+/* Profile the cycle cost of every key event, print with DBG_PRF (needs CONSOLE_ENABLE) */
+//#define PROCESS_RECORD_PROFILE
+
+/* Time the pixel kernels against their portable versions with DBG_PRF (needs CONSOLE_ENABLE) */
+//#define PIXEL_BENCH
+
+/* Time every LED pattern and lighting mode with DBG_PRF (needs CONSOLE_ENABLE), see also render_leds.py */
+//#define LED_BENCH
+
 #define RGB_MATRIX_KEYPRESSES
+/* Reactive effects look hit distances up (see rgb_matrix_kb.inc), so more hits stay affordable */
+#define LED_HITS_TO_REMEMBER 16
 #define RGB_MATRIX_LED_PROCESS_LIMIT 15
-#define RGB_MATRIX_LED_FLUSH_LIMIT 10
+/* LED frame interval (ms) is stretched at runtime by frame_budget.c to hold the matrix scan rate */
+#ifndef __ASSEMBLER__
+extern unsigned char led_frame_interval;
+#endif
+#define RGB_MATRIX_LED_FLUSH_LIMIT led_frame_interval
 
 #include "config_led.h"
@@ -168,6 +168,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
  { .id = 105, .x = -0.443, .y = -2.623, .adr = { .drv = 2, .cs = 10, .swr = 11, .swg = 10, .swb = 12 }, .scan = 255 }, \
 };
 
+//Scan codes of keys flagged LED_FLAG_MODIFIER in g_led_config, all other keys are LED_FLAG_KEYLIGHT
+//g_led_config is generated from ISSI3733_LED_MAP and this list by gen_led_config.py
+#define LED_MODIFIER_SCANCODES { 0, 13, 14, 15, 29, 30, 43, 44, 45, 57, 58, 59, 60, 61, 62, 70, 71, 72, 73, 74 }
+
 
 #define USB_LED_INDICATOR_ENABLE    //Comment out to disable indicator functionality
 #ifdef USB_LED_INDICATOR_ENABLE     //Scan codes refer to actual key matrix codes, not KC_* (255 to disable)
@@ -0,0 +1,242 @@
+// Generated by gen_led_config.py from ISSI3733_LED_MAP in config_led.h, do not edit
+
+#pragma once
+
+#define LED_CENTER_X 112
+#define LED_CENTER_Y 32
+#define LED_KEY_COUNT 67
+
+//Key matrix position to LED index
+#define LED_CONFIG_MATRIX { \
+    {      0,      1,      2,      3,      4,      5,      6,      7,      8,      9,     10,     11,     12,     13,     14 }, \
+    {     15,     16,     17,     18,     19,     20,     21,     22,     23,     24,     25,     26,     27,     28,     29 }, \
+    {     30,     31,     32,     33,     34,     35,     36,     37,     38,     39,     40,     41, NO_LED,     42,     43 }, \
+    {     44, NO_LED,     45,     46,     47,     48,     49,     50,     51,     52,     53,     54,     55,     56,     57 }, \
+    {     58,     59,     60, NO_LED, NO_LED, NO_LED,     61, NO_LED, NO_LED, NO_LED,     62,     63,     64,     65,     66 }, \
+}
+
+//LED positions scaled to (0-224, 0-64)
+#define LED_CONFIG_POINTS { \
+    {   8,  56 }, {  22,  56 }, {  35,  56 }, {  49,  56 }, {  63,  56 }, {  77,  56 }, {  91,  56 }, { 105,  56 }, { 118,  56 }, { 132,  56 }, { 146,  56 }, { 160,  56 }, { 174,  56 }, { 195,  56 }, { 215,  56 }, \
+    {  11,  44 }, {  28,  44 }, {  42,  44 }, {  56,  44 }, {  70,  44 }, {  84,  44 }, {  98,  44 }, { 112,  44 }, { 125,  44 }, { 139,  44 }, { 153,  44 }, { 167,  44 }, { 181,  44 }, { 198,  44 }, { 215,  44 }, \
+    {  13,  32 }, {  32,  32 }, {  46,  32 }, {  60,  32 }, {  73,  32 }, {  87,  32 }, { 101,  32 }, { 115,  32 }, { 129,  32 }, { 143,  32 }, { 156,  32 }, { 170,  32 }, { 193,  32 }, { 215,  32 }, {  16,  19 }, \
+    {  39,  19 }, {  53,  19 }, {  67,  19 }, {  80,  19 }, {  94,  19 }, { 108,  19 }, { 122,  19 }, { 136,  19 }, { 150,  19 }, { 163,  19 }, { 182,  19 }, { 201,  19 }, { 215,  19 }, {   9,   7 }, {  27,   7 }, \
+    {  44,   7 }, {  96,   7 }, { 148,   7 }, { 165,   7 }, { 188,   7 }, { 201,   7 }, { 215,   7 }, {   1,   1 }, {  15,   0 }, {  31,   0 }, {  47,   0 }, {  63,   0 }, {  79,   0 }, {  95,   0 }, { 112,   0 }, \
+    { 128,   0 }, { 144,   0 }, { 160,   0 }, { 176,   0 }, { 192,   0 }, { 208,   0 }, { 222,   1 }, { 224,  13 }, { 224,  25 }, { 224,  38 }, { 224,  50 }, { 222,  62 }, { 191,  64 }, { 179,  64 }, { 167,  64 }, \
+    { 153,  64 }, { 139,  64 }, { 125,  64 }, { 112,  64 }, {  98,  64 }, {  84,  64 }, {  70,  64 }, {  56,  64 }, {  42,  64 }, {  28,  64 }, {   1,  62 }, {   0,  50 }, {   0,  38 }, {   0,  25 }, {   0,  13 }, \
+}
+
+//LED_FLAG_* per LED
+#define LED_CONFIG_FLAGS { \
+      1,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   1,   1, \
+      1,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   1, \
+      9,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   1,   1,   1, \
+      4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   1,   1,   1,   1,   1, \
+      1,   4,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2, \
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, \
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, \
+}
+
+//Angle around the centre, 256 per full turn
+#define LED_POLAR_ANGLE { \
+    119, 117, 116, 113, 109, 104,  93,  76,  54,  36,  25,  19,  15,  11,   9, \
+    123, 122, 121, 119, 117, 112,  99,  64,  30,  17,  12,   9,   7,   6,   5, \
+    128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0, 133, \
+    135, 137, 139, 144, 153, 180, 219, 236, 243, 246, 249, 250, 251, 138, 140, \
+    142, 169, 231, 238, 243, 245, 246, 139, 141, 143, 147, 152, 159, 172, 192, \
+    211, 224, 232, 237, 240, 243, 245, 249, 253,   2,   6,  11,  16,  18,  21, \
+     27,  35,  48,  64,  81,  93, 101, 107, 111, 113, 117, 122, 126, 131, 135, \
+}
+
+//Distance from the centre in point units
+#define LED_POLAR_RADIUS { \
+    107,  93,  81,  67,  55,  42,  32,  25,  25,  31,  42,  54,  66,  86, 106, \
+    102,  85,  71,  57,  44,  30,  18,  12,  18,  30,  43,  56,  70,  87, 104, \
+     99,  80,  66,  52,  39,  25,  11,   3,  17,  31,  44,  58,  81, 103,  97, \
+     74,  60,  47,  35,  22,  14,  16,  27,  40,  53,  71,  90, 104, 106,  89, \
+     72,  30,  44,  59,  80,  92, 106, 115, 102,  87,  72,  59,  46,  36,  32, \
+     36,  45,  58,  72,  86, 101, 114, 114, 112, 112, 113, 114,  85,  74,  64, \
+     52,  42,  35,  32,  35,  43,  53,  64,  77,  90, 115, 113, 112, 112, 114, \
+}
+
+//Horizontal band (0-4) the LED falls into
+#define LED_ROW_BAND { \
+      4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4, \
+      3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3, \
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   1, \
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   0, \
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, \
+      0,   0,   0,   0,   0,   0,   0,   1,   1,   2,   3,   4,   4,   4,   4, \
+      4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   3,   2,   1,   1, \
+}
+
+//Vertical band (0-14) the LED falls into
+#define LED_COL_BAND { \
+      0,   1,   2,   3,   4,   5,   6,   7,   7,   8,   9,  10,  11,  13,  14, \
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14, \
+      0,   2,   3,   4,   4,   5,   6,   7,   8,   9,  10,  11,  12,  14,   1, \
+      2,   3,   4,   5,   6,   7,   8,   9,  10,  10,  12,  13,  14,   0,   1, \
+      2,   6,   9,  11,  12,  13,  14,   0,   1,   2,   3,   4,   5,   6,   7, \
+      8,   9,  10,  11,  12,  13,  14,  14,  14,  14,  14,  14,  12,  11,  11, \
+     10,   9,   8,   7,   6,   5,   4,   3,   2,   1,   0,   0,   0,   0,   0, \
+}
+
+//Driver index and red, green, blue PWM registers per LED
+#define LED_PWM_REGISTERS { \
+    { 1,  17,   1,  33 }, { 1,  66,  50,  82 }, { 1,  67,  51,  83 }, { 1,  68,  52,  84 }, { 1,  69,  53,  85 }, { 1,  70,  54,  86 }, { 1,  71,  55,  87 }, { 1,  28,  12,  44 }, \
+    { 0,  64,  48,  80 }, { 0,  65,  49,  81 }, { 0,  66,  50,  82 }, { 0,  67,  51,  83 }, { 0,  68,  52,  84 }, { 0,  69,  53,  85 }, { 0,  22,   6,  38 }, { 1,  65,  49,  81 }, \
+    { 1, 114,  98, 130 }, { 1, 115,  99, 131 }, { 1, 116, 100, 132 }, { 1, 117, 101, 133 }, { 1, 118, 102, 134 }, { 1, 119, 103, 135 }, { 0, 112,  96, 128 }, { 0, 113,  97, 129 }, \
+    { 0, 114,  98, 130 }, { 0, 115,  99, 131 }, { 0, 116, 100, 132 }, { 0, 170, 154, 186 }, { 0, 117, 101, 133 }, { 0,  70,  54,  86 }, { 1, 113,  97, 129 }, { 1, 162, 146, 178 }, \
+    { 1, 163, 147, 179 }, { 1, 164, 148, 180 }, { 1, 165, 149, 181 }, { 1, 166, 150, 182 }, { 1, 167, 151, 183 }, { 0, 160, 144, 176 }, { 0, 161, 145, 177 }, { 0, 162, 146, 178 }, \
+    { 0, 163, 147, 179 }, { 0, 164, 148, 180 }, { 0, 165, 149, 181 }, { 0, 118, 102, 134 }, { 1, 161, 145, 177 }, { 1,  72,  56,  88 }, { 1,  24,   8,  40 }, { 1, 168, 152, 184 }, \
+    { 1, 120, 104, 136 }, { 1, 171, 155, 187 }, { 1, 172, 156, 188 }, { 0, 168, 152, 184 }, { 0, 169, 153, 185 }, { 0, 121, 105, 137 }, { 0, 122, 106, 138 }, { 0,  26,  10,  42 }, \
+    { 0,  74,  58,  90 }, { 0, 166, 150, 182 }, { 1, 121, 105, 137 }, { 1,  73,  57,  89 }, { 1,  25,   9,  41 }, { 1, 123, 107, 139 }, { 0,  73,  57,  89 }, { 0,  25,   9,  41 }, \
+    { 0,  27,  11,  43 }, { 0, 123, 107, 139 }, { 0,  75,  59,  91 }, { 1, 170, 154, 186 }, { 1, 122, 106, 138 }, { 1,  74,  58,  90 }, { 1,  26,  10,  42 }, { 1,  27,  11,  43 }, \
+    { 1,  75,  59,  91 }, { 1,  76,  60,  92 }, { 1, 124, 108, 140 }, { 0, 120, 104, 136 }, { 0,  72,  56,  88 }, { 0,  24,   8,  40 }, { 0,  28,  12,  44 }, { 0, 124, 108, 140 }, \
+    { 0,  76,  60,  92 }, { 0, 172, 156, 188 }, { 0, 171, 155, 187 }, { 0, 167, 151, 183 }, { 0, 119, 103, 135 }, { 0,  71,  55,  87 }, { 0,  23,   7,  39 }, { 0,  21,   5,  37 }, \
+    { 0,  20,   4,  36 }, { 0,  19,   3,  35 }, { 0,  18,   2,  34 }, { 0,  17,   1,  33 }, { 0,  16,   0,  32 }, { 0,  29,  13,  45 }, { 1,  23,   7,  39 }, { 1,  22,   6,  38 }, \
+    { 1,  21,   5,  37 }, { 1,  20,   4,  36 }, { 1,  19,   3,  35 }, { 1,  18,   2,  34 }, { 1,  16,   0,  32 }, { 1,  64,  48,  80 }, { 1, 112,  96, 128 }, { 1, 160, 144, 176 }, \
+    { 1, 169, 153, 185 }, \
+}
+
+//Distance in point units from each key LED to every LED
+#define LED_HIT_DISTANCE { \
+    {   0,  14,  27,  41,  55,  69,  83,  97, 110, 124, 138, 152, 166, 187, 207,  12,  23,  36,  49,  63,  76,  90, 104, 117, 131, 145, 159, 173, 190, 207,  24,  33,  44,  57,  69,  82,  96, 109, 123, 137, 149, 163, 186, 208,  37,  48,  58,  69,  80,  93, 106, 119, 133, 146, 159, 177, 196, 210,  49,  52,  60, 100, 148, 164, 186, 199, 212,  55,  56,  60,  68,  78,  90, 103, 118, 132, 147, 161, 177, 192, 207, 220, 220, 218, 216, 216, 214, 183, 171, 159, 145, 131, 117, 104,  90,  76,  62,  48,  34,  21,   9,  10,  19,  32,  43 }, \
+    {  14,   0,  13,  27,  41,  55,  69,  83,  96, 110, 124, 138, 152, 173, 193,  16,  13,  23,  36,  49,  63,  76,  90, 103, 117, 131, 145, 159, 176, 193,  25,  26,  33,  44,  56,  69,  82,  96, 109, 123, 136, 149, 172, 194,  37,  40,  48,  58,  68,  80,  93, 106, 119, 133, 145, 164, 182, 196,  50,  49,  53,  88, 135, 151, 173, 185, 199,  58,  56,  56,  61,  69,  79,  92, 106, 119, 134, 148, 163, 178, 194, 207, 206, 204, 202, 202, 200, 169, 157, 145, 131, 117, 103,  90,  76,  62,  48,  34,  21,  10,  21,  22,  28,  38,  48 }, \
+    {  27,  13,   0,  14,  28,  42,  56,  70,  83,  97, 111, 125, 139, 160, 180,  26,  13,  13,  24,  37,  50,  64,  77,  90, 104, 118, 132, 146, 163, 180,  32,  24,  26,  34,  44,  57,  70,  83,  97, 110, 123, 137, 159, 181,  41,  37,  41,  48,  58,  69,  81,  94, 107, 120, 133, 151, 170, 183,  55,  49,  49,  78, 123, 138, 160, 173, 186,  64,  59,  56,  57,  62,  71,  82,  95, 108, 122, 136, 151, 166, 181, 194, 193, 191, 189, 189, 187, 156, 144, 132, 118, 104,  90,  77,  63,  49,  35,  22,  10,  10,  34,  35,  39,  46,  55 }, \
+    {  41,  27,  14,   0,  14,  28,  42,  56,  69,  83,  97, 111, 125, 146, 166,  39,  24,  13,  13,  24,  37,  50,  64,  76,  90, 104, 118, 132, 149, 166,  43,  29,  24,  26,  33,  44,  57,  70,  83,  97, 109, 123, 145, 167,  49,  38,  37,  41,  48,  58,  69,  81,  94, 107, 119, 138, 156, 170,  63,  53,  49,  67, 110, 125, 147, 159, 173,  73,  65,  58,  56,  57,  63,  72,  84,  96, 110, 124, 138, 153, 168, 181, 180, 177, 175, 175, 173, 142, 130, 118, 104,  90,  76,  63,  49,  35,  22,  10,  10,  22,  48,  49,  52,  57,  65 }, \
+    {  55,  41,  28,  14,   0,  14,  28,  42,  55,  69,  83,  97, 111, 132, 152,  53,  37,  24,  13,  13,  24,  37,  50,  63,  76,  90, 104, 118, 135, 152,  55,  39,  29,  24,  26,  33,  44,  57,  70,  83,  96, 109, 132, 153,  59,  44,  38,  37,  40,  48,  58,  69,  81,  94, 106, 124, 142, 156,  72,  60,  52,  59,  98, 113, 134, 146, 159,  82,  73,  64,  58,  56,  58,  64,  74,  85,  98, 112, 126, 140, 155, 168, 166, 163, 162, 161, 159, 128, 116, 104,  90,  76,  62,  49,  35,  22,  10,  10,  22,  35,  62,  63,  65,  70,  76 }, \
+    {  69,  55,  42,  28,  14,   0,  14,  28,  41,  55,  69,  83,  97, 118, 138,  67,  50,  37,  24,  13,  13,  24,  37,  49,  63,  76,  90, 104, 121, 138,  68,  51,  39,  29,  24,  26,  33,  44,  57,  70,  82,  96, 118, 140,  71,  53,  44,  38,  37,  40,  48,  58,  69,  81,  93, 111, 129, 142,  83,  70,  59,  52,  86, 100, 121, 133, 146,  93,  83,  72,  63,  57,  56,  58,  66,  75,  87, 100, 113, 127, 142, 155, 153, 150, 148, 147, 145, 114, 102,  90,  76,  62,  48,  35,  22,  10,  10,  22,  35,  49,  76,  77,  79,  83,  88 }, \
+    {  83,  69,  56,  42,  28,  14,   0,  14,  27,  41,  55,  69,  83, 104, 124,  80,  64,  50,  37,  24,  13,  13,  24,  36,  49,  63,  76,  90, 107, 124,  81,  63,  51,  39,  30,  24,  26,  33,  44,  57,  69,  82, 104, 126,  83,  63,  53,  44,  38,  37,  40,  48,  58,  69,  80,  98, 116, 129,  95,  80,  67,  49,  75,  88, 108, 120, 133, 105,  94,  82,  71,  62,  57,  56,  59,  67,  77,  88, 101, 115, 129, 142, 139, 136, 134, 133, 131, 100,  88,  76,  62,  48,  34,  22,  10,  10,  22,  35,  49,  63,  90,  91,  92,  96, 100 }, \
+    {  97,  83,  70,  56,  42,  28,  14,   0,  13,  27,  41,  55,  69,  90, 110,  94,  77,  64,  50,  37,  24,  13,  13,  23,  36,  49,  63,  76,  93, 110,  95,  76,  63,  51,  40,  30,  24,  26,  33,  44,  56,  69,  91, 112,  96,  75,  63,  53,  44,  38,  37,  40,  48,  58,  68,  85, 102, 116, 107,  92,  78,  49,  65,  77,  96, 107, 120, 117, 106,  92,  80,  70,  61,  56,  56,  60,  68,  78,  90, 103, 117, 129, 126, 122, 120, 119, 117,  86,  74,  62,  48,  34,  21,  10,  10,  22,  35,  49,  63,  77, 104, 105, 106, 109, 113 }, \
+    { 110,  96,  83,  69,  55,  41,  27,  13,   0,  14,  28,  42,  56,  77,  97, 107,  90,  76,  63,  49,  36,  23,  13,  13,  24,  37,  50,  64,  80,  97, 107,  89,  75,  62,  51,  39,  29,  24,  26,  34,  44,  57,  78,  99, 108,  87,  74,  63,  53,  44,  38,  37,  41,  48,  58,  73,  90, 103, 119, 103,  88,  53,  57,  67,  85,  96, 108, 129, 117, 103,  90,  78,  68,  60,  56,  56,  61,  70,  80,  92, 106, 117, 114, 110, 107, 106, 104,  73,  61,  49,  35,  22,  10,  10,  21,  34,  48,  62,  76,  90, 117, 118, 119, 122, 125 }, \
+    { 124, 110,  97,  83,  69,  55,  41,  27,  14,   0,  14,  28,  42,  63,  83, 121, 104,  90,  76,  63,  49,  36,  23,  13,  13,  24,  37,  50,  67,  83, 121, 102,  89,  75,  63,  51,  39,  29,  24,  26,  33,  44,  65,  86, 121, 100,  87,  74,  63,  53,  44,  38,  37,  41,  48,  62,  78,  90, 132, 115, 100,  60,  51,  59,  74,  84,  96, 142, 129, 115, 101,  88,  77,  67,  59,  56,  57,  62,  71,  82,  94, 105, 101,  97,  93,  92,  90,  59,  47,  35,  22,  10,  10,  21,  34,  48,  62,  76,  90, 104, 131, 132, 133, 135, 138 }, \
+    { 138, 124, 111,  97,  83,  69,  55,  41,  28,  14,   0,  14,  28,  49,  69, 135, 118, 104,  90,  76,  63,  49,  36,  24,  13,  13,  24,  37,  53,  70, 135, 116, 102,  89,  76,  63,  51,  39,  29,  24,  26,  33,  52,  73, 135, 113, 100,  87,  75,  63,  53,  44,  38,  37,  40,  51,  66,  78, 145, 128, 113,  70,  49,  52,  64,  73,  84, 155, 142, 127, 113, 100,  87,  75,  65,  58,  56,  57,  63,  72,  83,  93,  89,  83,  80,  78,  76,  45,  33,  22,  10,  10,  22,  34,  48,  62,  76,  90, 104, 118, 145, 146, 147, 149, 152 }, \
+    { 152, 138, 125, 111,  97,  83,  69,  55,  42,  28,  14,   0,  14,  35,  55, 149, 132, 118, 104,  90,  76,  63,  49,  37,  24,  13,  13,  24,  39,  56, 148, 130, 116, 102,  90,  76,  63,  51,  39,  29,  24,  26,  40,  60, 148, 126, 113, 100,  88,  75,  63,  53,  44,  38,  37,  43,  55,  66, 158, 141, 125,  80,  50,  49,  56,  63,  73, 168, 155, 140, 126, 112,  98,  85,  73,  64,  58,  56,  58,  64,  73,  82,  77,  71,  66,  64,  62,  32,  20,  10,  10,  22,  35,  48,  62,  76,  90, 104, 118, 132, 159, 160, 161, 162, 165 }, \
+    { 166, 152, 139, 125, 111,  97,  83,  69,  56,  42,  28,  14,   0,  21,  41, 163, 146, 132, 118, 104,  90,  76,  63,  50,  37,  24,  13,  13,  26,  42, 162, 144, 130, 116, 103,  90,  76,  63,  51,  39,  30,  24,  30,  47, 162, 139, 126, 113, 101,  88,  75,  63,  53,  44,  38,  37,  45,  55, 172, 154, 138,  92,  55,  49,  50,  55,  63, 181, 168, 153, 138, 124, 110,  96,  83,  72,  63,  57,  56,  58,  65,  73,  65,  58,  53,  50,  48,  18,   9,  10,  22,  35,  49,  62,  76,  90, 104, 118, 132, 146, 173, 174, 174, 176, 179 }, \
+    { 187, 173, 160, 146, 132, 118, 104,  90,  77,  63,  49,  35,  21,   0,  20, 184, 167, 153, 139, 125, 111,  97,  83,  71,  57,  43,  30,  18,  12,  23, 183, 164, 150, 137, 124, 110,  97,  83,  70,  57,  45,  34,  24,  31, 182, 160, 146, 133, 120, 107,  94,  81,  69,  58,  48,  39,  37,  42, 192, 175, 158, 110,  67,  57,  49,  49,  52, 201, 188, 173, 158, 143, 128, 114, 100,  87,  75,  66,  59,  56,  57,  61,  51,  42,  34,  29,  27,   8,  17,  29,  42,  56,  70,  83,  97, 111, 125, 139, 153, 167, 194, 195, 195, 197, 199 }, \
+    { 207, 193, 180, 166, 152, 138, 124, 110,  97,  83,  69,  55,  41,  20,   0, 204, 187, 173, 159, 145, 131, 117, 103,  90,  76,  63,  49,  36,  20,  12, 203, 184, 170, 156, 144, 130, 116, 102,  89,  75,  63,  51,  32,  24, 202, 179, 166, 152, 139, 126, 113, 100,  87,  74,  63,  49,  39,  37, 211, 194, 177, 128,  83,  70,  55,  50,  49, 220, 207, 192, 177, 161, 147, 132, 117, 103,  90,  78,  68,  60,  56,  55,  43,  32,  20,  10,   9,  25,  36,  48,  62,  76,  90, 103, 117, 131, 145, 159, 173, 187, 214, 215, 215, 217, 219 }, \
+    {  12,  16,  26,  39,  53,  67,  80,  94, 107, 121, 135, 149, 163, 184, 204,   0,  17,  31,  45,  59,  73,  87, 101, 114, 128, 142, 156, 170, 187, 204,  12,  24,  37,  50,  63,  76,  90, 104, 118, 132, 145, 159, 182, 204,  25,  37,  48,  61,  73,  86, 100, 113, 127, 141, 154, 172, 191, 205,  37,  40,  49,  92, 141, 158, 180, 193, 207,  44,  44,  48,  56,  68,  80,  94, 110, 125, 140, 155, 170, 186, 201, 215, 215, 213, 213, 213, 211, 181, 169, 157, 143, 129, 115, 102,  89,  75,  62,  49,  36,  26,  20,  12,  12,  21,  32 }, \
+    {  23,  13,  13,  24,  37,  50,  64,  77,  90, 104, 118, 132, 146, 167, 187,  17,   0,  14,  28,  42,  56,  70,  84,  97, 111, 125, 139, 153, 170, 187,  19,  12,  21,  34,  46,  60,  73,  87, 101, 115, 128, 142, 165, 187,  27,  27,  35,  46,  57,  70,  83,  97, 110, 124, 137, 156, 174, 188,  41,  37,  40,  77, 125, 141, 164, 176, 190,  50,  45,  44,  47,  56,  67,  80,  94, 109, 124, 139, 154, 169, 185, 198, 198, 196, 196, 196, 194, 164, 152, 140, 126, 112,  99,  86,  72,  59,  46,  34,  24,  20,  32,  28,  28,  33,  41 }, \
+    {  36,  23,  13,  13,  24,  37,  50,  64,  76,  90, 104, 118, 132, 153, 173,  31,  14,   0,  14,  28,  42,  56,  70,  83,  97, 111, 125, 139, 156, 173,  31,  15,  12,  21,  33,  46,  60,  73,  87, 101, 114, 128, 151, 173,  36,  25,  27,  35,  45,  57,  70,  83,  97, 110, 123, 142, 160, 174,  49,  39,  37,  65, 112, 128, 150, 163, 176,  59,  51,  45,  44,  48,  57,  68,  82,  96, 111, 125, 141, 156, 171, 185, 184, 182, 182, 182, 180, 150, 138, 126, 112,  99,  85,  72,  59,  46,  34,  24,  20,  24,  44,  42,  42,  46,  52 }, \
+    {  49,  36,  24,  13,  13,  24,  37,  50,  63,  76,  90, 104, 118, 139, 159,  45,  28,  14,   0,  14,  28,  42,  56,  69,  83,  97, 111, 125, 142, 159,  44,  26,  15,  12,  20,  33,  46,  60,  73,  87, 100, 114, 137, 159,  47,  30,  25,  27,  34,  45,  57,  70,  83,  97, 109, 128, 147, 160,  59,  47,  38,  54,  99, 115, 137, 149, 163,  69,  60,  50,  44,  44,  49,  58,  71,  84,  98, 112, 127, 142, 158, 171, 170, 169, 168, 168, 166, 136, 124, 112,  99,  85,  71,  59,  46,  34,  24,  20,  24,  34,  57,  56,  56,  59,  64 }, \
+    {  63,  49,  37,  24,  13,  13,  24,  37,  49,  63,  76,  90, 104, 125, 145,  59,  42,  28,  14,   0,  14,  28,  42,  55,  69,  83,  97, 111, 128, 145,  58,  39,  26,  15,  12,  20,  33,  46,  60,  73,  86, 100, 123, 145,  59,  39,  30,  25,  26,  34,  45,  57,  70,  83,  96, 114, 133, 147,  71,  56,  45,  45,  86, 101, 123, 136, 149,  81,  70,  58,  49,  44,  44,  50,  60,  72,  86, 100, 114, 129, 144, 157, 157, 155, 154, 154, 153, 122, 110,  99,  85,  71,  58,  46,  34,  24,  20,  24,  34,  46,  71,  70,  70,  72,  76 }, \
+    {  76,  63,  50,  37,  24,  13,  13,  24,  36,  49,  63,  76,  90, 111, 131,  73,  56,  42,  28,  14,   0,  14,  28,  41,  55,  69,  83,  97, 114, 131,  72,  53,  39,  26,  16,  12,  20,  33,  46,  60,  72,  86, 109, 131,  72,  51,  39,  30,  25,  26,  34,  45,  57,  70,  82, 101, 119, 133,  83,  67,  54,  38,  73,  89, 110, 122, 136,  93,  81,  68,  57,  48,  44,  45,  52,  62,  74,  87, 101, 116, 131, 144, 143, 141, 140, 140, 139, 108,  97,  85,  71,  58,  45,  34,  24,  20,  24,  34,  46,  59,  84,  84,  84,  86,  89 }, \
+    {  90,  76,  64,  50,  37,  24,  13,  13,  23,  36,  49,  63,  76,  97, 117,  87,  70,  56,  42,  28,  14,   0,  14,  27,  41,  55,  69,  83, 100, 117,  85,  67,  53,  39,  27,  16,  12,  20,  33,  46,  59,  72,  95, 117,  85,  64,  51,  39,  30,  25,  26,  34,  45,  57,  69,  87, 105, 119,  96,  80,  65,  37,  62,  76,  97, 109, 122, 106,  93,  80,  67,  56,  47,  44,  46,  53,  63,  76,  89, 103, 118, 131, 129, 127, 126, 126, 125,  95,  83,  71,  58,  45,  33,  24,  20,  24,  34,  46,  59,  72,  98,  98,  98,  99, 102 }, \
+    { 104,  90,  77,  64,  50,  37,  24,  13,  13,  23,  36,  49,  63,  83, 103, 101,  84,  70,  56,  42,  28,  14,   0,  13,  27,  41,  55,  69,  86, 103,  99,  80,  67,  53,  40,  27,  16,  12,  20,  33,  45,  59,  81, 103,  99,  77,  64,  51,  40,  30,  25,  26,  34,  45,  56,  74,  92, 105, 109,  92,  77,  40,  51,  64,  84,  96, 109, 119, 106,  92,  78,  65,  55,  47,  44,  46,  54,  65,  77,  91, 105, 118, 116, 113, 112, 112, 111,  81,  69,  58,  45,  33,  23,  20,  24,  34,  46,  59,  72,  86, 112, 112, 112, 113, 116 }, \
+    { 117, 103,  90,  76,  63,  49,  36,  23,  13,  13,  24,  37,  50,  71,  90, 114,  97,  83,  69,  55,  41,  27,  13,   0,  14,  28,  42,  56,  73,  90, 112,  93,  79,  66,  53,  39,  26,  15,  12,  21,  33,  46,  69,  90, 111,  89,  76,  63,  51,  39,  30,  25,  27,  35,  45,  62,  80,  93, 121, 104,  89,  47,  43,  54,  73,  84,  97, 131, 118, 103,  89,  76,  63,  53,  45,  44,  47,  56,  67,  80,  93, 106, 103, 100,  99,  99,  98,  68,  57,  46,  34,  24,  20,  23,  33,  45,  58,  71,  85,  99, 125, 125, 125, 126, 128 }, \
+    { 131, 117, 104,  90,  76,  63,  49,  36,  24,  13,  13,  24,  37,  57,  76, 128, 111,  97,  83,  69,  55,  41,  27,  14,   0,  14,  28,  42,  59,  76, 126, 107,  93,  79,  67,  53,  39,  26,  15,  12,  20,  33,  55,  76, 125, 103,  89,  76,  64,  51,  39,  30,  25,  27,  34,  49,  66,  80, 135, 117, 101,  56,  38,  45,  61,  72,  84, 144, 131, 116, 101,  87,  74,  62,  51,  45,  44,  48,  57,  68,  81,  93,  90,  87,  85,  85,  84,  55,  44,  34,  24,  20,  24,  33,  45,  58,  71,  85,  99, 112, 139, 139, 139, 140, 142 }, \
+    { 145, 131, 118, 104,  90,  76,  63,  49,  37,  24,  13,  13,  24,  43,  63, 142, 125, 111,  97,  83,  69,  55,  41,  28,  14,   0,  14,  28,  45,  62, 140, 121, 107,  93,  80,  67,  53,  39,  26,  15,  12,  20,  41,  63, 139, 116, 103,  89,  77,  64,  51,  39,  30,  25,  26,  38,  54,  66, 148, 131, 115,  67,  37,  38,  50,  60,  72, 157, 144, 129, 114, 100,  86,  72,  60,  50,  44,  44,  49,  58,  70,  81,  77,  73,  71,  71,  71,  42,  32,  24,  20,  24,  34,  45,  58,  71,  85,  99, 112, 126, 153, 153, 153, 154, 156 }, \
+    { 159, 145, 132, 118, 104,  90,  76,  63,  50,  37,  24,  13,  13,  30,  49, 156, 139, 125, 111,  97,  83,  69,  55,  42,  28,  14,   0,  14,  31,  48, 154, 135, 121, 107,  94,  80,  67,  53,  39,  26,  16,  12,  28,  49, 153, 130, 116, 103,  90,  77,  64,  51,  39,  30,  25,  29,  42,  54, 162, 144, 128,  80,  41,  37,  42,  50,  60, 171, 158, 142, 127, 112,  98,  84,  70,  58,  49,  44,  44,  50,  60,  69,  64,  60,  57,  57,  57,  31,  23,  20,  24,  34,  46,  58,  71,  85,  99, 112, 126, 140, 166, 167, 167, 168, 169 }, \
+    { 173, 159, 146, 132, 118, 104,  90,  76,  64,  50,  37,  24,  13,  18,  36, 170, 153, 139, 125, 111,  97,  83,  69,  56,  42,  28,  14,   0,  17,  34, 168, 149, 135, 121, 108,  94,  80,  67,  53,  39,  27,  16,  16,  36, 166, 144, 130, 116, 104,  90,  77,  64,  51,  39,  30,  25,  32,  42, 175, 158, 141,  92,  49,  40,  37,  42,  50, 185, 171, 156, 141, 125, 111,  96,  81,  68,  57,  48,  44,  45,  51,  59,  53,  47,  43,  43,  44,  22,  20,  24,  34,  46,  59,  71,  85,  99, 112, 126, 140, 154, 180, 181, 181, 181, 183 }, \
+    { 190, 176, 163, 149, 135, 121, 107,  93,  80,  67,  53,  39,  26,  12,  20, 187, 170, 156, 142, 128, 114, 100,  86,  73,  59,  45,  31,  17,   0,  17, 185, 166, 152, 138, 125, 111,  97,  83,  70,  56,  43,  30,  13,  20, 183, 160, 147, 133, 120, 106,  93,  80,  66,  54,  43,  29,  25,  30, 192, 174, 158, 108,  62,  49,  38,  37,  40, 201, 188, 172, 157, 141, 126, 112,  96,  82,  69,  58,  49,  44,  45,  49,  40,  32,  26,  26,  30,  21,  27,  36,  49,  62,  75,  88, 101, 115, 129, 143, 157, 171, 197, 198, 198, 198, 200 }, \
+    { 207, 193, 180, 166, 152, 138, 124, 110,  97,  83,  70,  56,  42,  23,  12, 204, 187, 173, 159, 145, 131, 117, 103,  90,  76,  62,  48,  34,  17,   0, 202, 183, 169, 155, 142, 128, 114, 100,  86,  72,  60,  46,  25,  12, 200, 177, 163, 150, 137, 123, 109,  96,  82,  69,  57,  41,  28,  25, 209, 191, 174, 124,  76,  62,  45,  39,  37, 218, 204, 189, 173, 158, 142, 127, 112,  97,  83,  70,  58,  49,  44,  43,  32,  21,  10,  10,  19,  31,  41,  52,  65,  78,  92, 104, 118, 132, 146, 160, 174, 188, 214, 215, 215, 215, 217 }, \
+    {  24,  25,  32,  43,  55,  68,  81,  95, 107, 121, 135, 148, 162, 183, 203,  12,  19,  31,  44,  58,  72,  85,  99, 112, 126, 140, 154, 168, 185, 202,   0,  19,  33,  47,  60,  74,  88, 102, 116, 130, 143, 157, 180, 202,  13,  29,  42,  55,  68,  82,  95, 109, 123, 137, 150, 169, 188, 202,  25,  28,  39,  86, 137, 154, 176, 189, 203,  33,  32,  36,  46,  59,  73,  88, 104, 119, 134, 150, 166, 181, 197, 211, 211, 211, 211, 211, 211, 180, 169, 157, 143, 130, 116, 104,  90,  77,  65,  53,  43,  35,  32,  22,  14,  14,  23 }, \
+    {  33,  26,  24,  29,  39,  51,  63,  76,  89, 102, 116, 130, 144, 164, 184,  24,  12,  15,  26,  39,  53,  67,  80,  93, 107, 121, 135, 149, 166, 183,  19,   0,  14,  28,  41,  55,  69,  83,  97, 111, 124, 138, 161, 183,  20,  14,  24,  37,  49,  63,  77,  90, 104, 118, 131, 150, 169, 183,  33,  25,  27,  68, 118, 135, 157, 170, 184,  43,  36,  32,  35,  44,  56,  70,  86, 101, 116, 131, 147, 163, 178, 192, 192, 192, 192, 192, 192, 162, 150, 138, 125, 111,  98,  86,  73,  61,  49,  40,  33,  32,  43,  36,  32,  32,  37 }, \
+    {  44,  33,  26,  24,  29,  39,  51,  63,  75,  89, 102, 116, 130, 150, 170,  37,  21,  12,  15,  26,  39,  53,  67,  79,  93, 107, 121, 135, 152, 169,  33,  14,   0,  14,  27,  41,  55,  69,  83,  97, 110, 124, 147, 169,  32,  14,  14,  24,  36,  49,  63,  77,  90, 104, 117, 136, 155, 169,  44,  31,  25,  55, 105, 121, 144, 157, 170,  54,  44,  35,  32,  36,  45,  58,  73,  88, 103, 118, 133, 149, 165, 178, 179, 178, 178, 178, 178, 148, 136, 125, 111,  98,  85,  73,  61,  49,  40,  33,  32,  36,  54,  49,  46,  46,  49 }, \
+    {  57,  44,  34,  26,  24,  29,  39,  51,  62,  75,  89, 102, 116, 137, 156,  50,  34,  21,  12,  15,  26,  39,  53,  66,  79,  93, 107, 121, 138, 155,  47,  28,  14,   0,  13,  27,  41,  55,  69,  83,  96, 110, 133, 155,  45,  24,  14,  14,  23,  36,  49,  63,  77,  90, 103, 122, 141, 155,  56,  41,  29,  43,  91, 107, 130, 143, 157,  66,  55,  43,  34,  32,  37,  47,  61,  75,  89, 104, 120, 135, 151, 164, 165, 164, 164, 164, 164, 134, 123, 111,  98,  85,  72,  61,  49,  40,  33,  32,  36,  45,  66,  62,  60,  60,  62 }, \
+    {  69,  56,  44,  33,  26,  24,  30,  40,  51,  63,  76,  90, 103, 124, 144,  63,  46,  33,  20,  12,  16,  27,  40,  53,  67,  80,  94, 108, 125, 142,  60,  41,  27,  13,   0,  14,  28,  42,  56,  70,  83,  97, 120, 142,  58,  36,  23,  14,  14,  24,  37,  50,  64,  78,  90, 109, 128, 142,  68,  52,  38,  33,  79,  95, 117, 130, 144,  78,  66,  52,  41,  33,  32,  38,  50,  63,  77,  92, 107, 123, 138, 152, 152, 151, 151, 152, 151, 122, 110,  99,  86,  73,  61,  50,  40,  33,  32,  36,  44,  55,  78,  75,  73,  73,  75 }, \
+    {  82,  69,  57,  44,  33,  26,  24,  30,  39,  51,  63,  76,  90, 110, 130,  76,  60,  46,  33,  20,  12,  16,  27,  39,  53,  67,  80,  94, 111, 128,  74,  55,  41,  27,  14,   0,  14,  28,  42,  56,  69,  83, 106, 128,  72,  49,  36,  23,  14,  14,  24,  37,  50,  64,  77,  95, 114, 128,  81,  65,  49,  26,  65,  81, 104, 116, 130,  91,  78,  64,  51,  40,  32,  32,  40,  52,  65,  79,  94, 109, 125, 138, 138, 137, 137, 138, 138, 108,  97,  86,  73,  61,  49,  40,  33,  32,  36,  44,  55,  67,  91,  88,  87,  87,  89 }, \
+    {  96,  82,  70,  57,  44,  33,  26,  24,  29,  39,  51,  63,  76,  97, 116,  90,  73,  60,  46,  33,  20,  12,  16,  26,  39,  53,  67,  80,  97, 114,  88,  69,  55,  41,  28,  14,   0,  14,  28,  42,  55,  69,  92, 114,  85,  63,  49,  36,  24,  14,  14,  24,  37,  50,  63,  82, 100, 114,  95,  78,  62,  25,  53,  68,  90, 103, 116, 104,  91,  76,  62,  49,  38,  32,  33,  41,  53,  67,  81,  96, 111, 124, 124, 123, 123, 124, 124,  95,  84,  73,  61,  49,  40,  33,  32,  36,  44,  55,  67,  79, 104, 102, 101, 101, 102 }, \
+    { 109,  96,  83,  70,  57,  44,  33,  26,  24,  29,  39,  51,  63,  83, 102, 104,  87,  73,  60,  46,  33,  20,  12,  15,  26,  39,  53,  67,  83, 100, 102,  83,  69,  55,  42,  28,  14,   0,  14,  28,  41,  55,  78, 100,  99,  77,  63,  49,  37,  24,  14,  14,  24,  37,  49,  68,  86, 100, 108,  91,  75,  31,  41,  55,  77,  89, 103, 118, 104,  89,  75,  61,  48,  37,  32,  34,  43,  55,  68,  83,  98, 111, 110, 109, 109, 110, 111,  82,  71,  61,  49,  40,  33,  32,  36,  44,  55,  67,  79,  92, 117, 116, 115, 115, 116 }, \
+    { 123, 109,  97,  83,  70,  57,  44,  33,  26,  24,  29,  39,  51,  70,  89, 118, 101,  87,  73,  60,  46,  33,  20,  12,  15,  26,  39,  53,  70,  86, 116,  97,  83,  69,  56,  42,  28,  14,   0,  14,  27,  41,  64,  86, 113,  90,  77,  63,  50,  37,  24,  14,  14,  24,  36,  54,  73,  86, 122, 105,  88,  41,  31,  43,  64,  76,  89, 131, 118, 103,  88,  73,  59,  46,  36,  32,  35,  44,  56,  70,  85,  98,  96,  95,  95,  96,  97,  69,  59,  49,  40,  33,  32,  36,  44,  55,  67,  79,  92, 105, 131, 130, 129, 129, 130 }, \
+    { 137, 123, 110,  97,  83,  70,  57,  44,  34,  26,  24,  29,  39,  57,  75, 132, 115, 101,  87,  73,  60,  46,  33,  21,  12,  15,  26,  39,  56,  72, 130, 111,  97,  83,  70,  56,  42,  28,  14,   0,  13,  27,  50,  72, 127, 104,  90,  77,  64,  50,  37,  24,  14,  14,  23,  41,  59,  73, 136, 118, 102,  53,  25,  33,  51,  63,  76, 145, 131, 116, 101,  86,  71,  57,  44,  35,  32,  36,  45,  58,  72,  84,  83,  81,  81,  82,  84,  57,  48,  40,  33,  32,  36,  44,  55,  67,  79,  92, 105, 119, 145, 144, 143, 143, 144 }, \
+    { 149, 136, 123, 109,  96,  82,  69,  56,  44,  33,  26,  24,  30,  45,  63, 145, 128, 114, 100,  86,  72,  59,  45,  33,  20,  12,  16,  27,  43,  60, 143, 124, 110,  96,  83,  69,  55,  41,  27,  13,   0,  14,  37,  59, 140, 117, 103,  89,  77,  63,  49,  36,  23,  14,  14,  29,  46,  60, 149, 131, 114,  65,  26,  26,  40,  51,  64, 158, 144, 129, 113,  98,  83,  68,  54,  42,  34,  32,  37,  48,  61,  72,  70,  68,  68,  70,  72,  47,  39,  33,  32,  36,  44,  54,  66,  78,  91, 104, 118, 131, 157, 157, 156, 156, 157 }, \
+    { 163, 149, 137, 123, 109,  96,  82,  69,  57,  44,  33,  26,  24,  34,  51, 159, 142, 128, 114, 100,  86,  72,  59,  46,  33,  20,  12,  16,  30,  46, 157, 138, 124, 110,  97,  83,  69,  55,  41,  27,  14,   0,  23,  45, 154, 131, 117, 103,  90,  77,  63,  49,  36,  23,  14,  17,  33,  46, 162, 145, 128,  78,  33,  25,  30,  39,  51, 171, 158, 142, 127, 111,  96,  81,  66,  52,  41,  33,  32,  38,  49,  60,  57,  54,  54,  56,  60,  38,  33,  32,  36,  44,  55,  66,  78,  91, 104, 118, 131, 145, 171, 170, 170, 170, 171 }, \
+    { 186, 172, 159, 145, 132, 118, 104,  91,  78,  65,  52,  40,  30,  24,  32, 182, 165, 151, 137, 123, 109,  95,  81,  69,  55,  41,  28,  16,  13,  25, 180, 161, 147, 133, 120, 106,  92,  78,  64,  50,  37,  23,   0,  22, 177, 154, 140, 126, 113,  99,  85,  72,  58,  44,  32,  17,  15,  25, 185, 167, 151, 100,  51,  37,  25,  26,  33, 194, 180, 165, 149, 133, 118, 103,  87,  72,  58,  45,  36,  32,  35,  42,  36,  31,  31,  35,  41,  32,  34,  41,  51,  62,  75,  87, 100, 113, 127, 140, 154, 168, 194, 193, 193, 193, 193 }, \
+    { 208, 194, 181, 167, 153, 140, 126, 112,  99,  86,  73,  60,  47,  31,  24, 204, 187, 173, 159, 145, 131, 117, 103,  90,  76,  63,  49,  36,  20,  12, 202, 183, 169, 155, 142, 128, 114, 100,  86,  72,  59,  45,  22,   0, 199, 176, 162, 148, 135, 121, 107,  93,  80,  66,  53,  35,  19,  13, 207, 189, 172, 121,  71,  55,  36,  28,  25, 216, 202, 186, 171, 155, 139, 124, 107,  92,  77,  63,  50,  39,  32,  31,  21,  11,  10,  20,  30,  40,  48,  57,  69,  82,  95, 107, 121, 134, 148, 162, 175, 189, 216, 215, 215, 215, 215 }, \
+    {  37,  37,  41,  49,  59,  71,  83,  96, 108, 121, 135, 148, 162, 182, 202,  25,  27,  36,  47,  59,  72,  85,  99, 111, 125, 139, 153, 166, 183, 200,  13,  20,  32,  45,  58,  72,  85,  99, 113, 127, 140, 154, 177, 199,   0,  23,  37,  51,  64,  78,  92, 106, 120, 134, 147, 166, 185, 199,  13,  16,  30,  80, 132, 149, 172, 185, 199,  23,  19,  24,  36,  50,  65,  81,  97, 113, 129, 145, 161, 177, 192, 206, 208, 208, 208, 210, 210, 180, 169, 157, 144, 130, 117, 106,  93,  81,  70,  60,  51,  46,  45,  34,  24,  17,  17 }, \
+    {  48,  40,  37,  38,  44,  53,  63,  75,  87, 100, 113, 126, 139, 160, 179,  37,  27,  25,  30,  39,  51,  64,  77,  89, 103, 116, 130, 144, 160, 177,  29,  14,  14,  24,  36,  49,  63,  77,  90, 104, 117, 131, 154, 176,  23,   0,  14,  28,  41,  55,  69,  83,  97, 111, 124, 143, 162, 176,  32,  16,  13,  58, 109, 126, 149, 162, 176,  42,  30,  20,  20,  30,  44,  59,  75,  91, 106, 122, 138, 154, 170, 183, 185, 185, 185, 187, 187, 158, 147, 135, 122, 109,  97,  85,  74,  63,  54,  48,  45,  46,  57,  49,  43,  39,  39 }, \
+    {  58,  48,  41,  37,  38,  44,  53,  63,  74,  87, 100, 113, 126, 146, 166,  48,  35,  27,  25,  30,  39,  51,  64,  76,  89, 103, 116, 130, 147, 163,  42,  24,  14,  14,  23,  36,  49,  63,  77,  90, 103, 117, 140, 162,  37,  14,   0,  14,  27,  41,  55,  69,  83,  97, 110, 129, 148, 162,  45,  28,  15,  44,  95, 112, 135, 148, 162,  55,  42,  29,  19,  21,  32,  46,  61,  77,  92, 108, 124, 140, 156, 169, 171, 171, 172, 173, 174, 145, 133, 122, 109,  97,  84,  74,  63,  54,  48,  45,  46,  51,  67,  61,  56,  53,  53 }, \
+    {  69,  58,  48,  41,  37,  38,  44,  53,  63,  74,  87, 100, 113, 133, 152,  61,  46,  35,  27,  25,  30,  39,  51,  63,  76,  89, 103, 116, 133, 150,  55,  37,  24,  14,  14,  23,  36,  49,  63,  77,  89, 103, 126, 148,  51,  28,  14,   0,  13,  27,  41,  55,  69,  83,  96, 115, 134, 148,  59,  41,  25,  31,  81,  98, 121, 134, 148,  68,  55,  40,  27,  19,  22,  33,  48,  63,  79,  94, 110, 126, 142, 156, 157, 157, 158, 160, 160, 131, 120, 109,  97,  84,  73,  63,  54,  48,  45,  46,  51,  59,  78,  73,  69,  67,  67 }, \
+    {  80,  68,  58,  48,  40,  37,  38,  44,  53,  63,  75,  88, 101, 120, 139,  73,  57,  45,  34,  26,  25,  30,  40,  51,  64,  77,  90, 104, 120, 137,  68,  49,  36,  23,  14,  14,  24,  37,  50,  64,  77,  90, 113, 135,  64,  41,  27,  13,   0,  14,  28,  42,  56,  70,  83, 102, 121, 135,  72,  54,  37,  20,  69,  85, 108, 121, 135,  81,  67,  52,  38,  25,  19,  24,  37,  51,  66,  82,  97, 113, 129, 143, 144, 144, 145, 147, 148, 119, 108,  97,  85,  74,  63,  55,  48,  45,  46,  51,  58,  68,  89,  85,  82,  80,  80 }, \
+    {  93,  80,  69,  58,  48,  40,  37,  38,  44,  53,  63,  75,  88, 107, 126,  86,  70,  57,  45,  34,  26,  25,  30,  39,  51,  64,  77,  90, 106, 123,  82,  63,  49,  36,  24,  14,  14,  24,  37,  50,  63,  77,  99, 121,  78,  55,  41,  27,  14,   0,  14,  28,  42,  56,  69,  88, 107, 121,  85,  68,  51,  12,  55,  72,  94, 107, 121,  94,  81,  65,  50,  36,  24,  19,  26,  38,  53,  68,  84,  99, 115, 129, 130, 130, 131, 133, 135, 106,  96,  85,  74,  63,  54,  48,  45,  46,  51,  58,  68,  79, 102,  98,  95,  94,  94 }, \
+    { 106,  93,  81,  69,  58,  48,  40,  37,  38,  44,  53,  63,  75,  94, 113, 100,  83,  70,  57,  45,  34,  26,  25,  30,  39,  51,  64,  77,  93, 109,  95,  77,  63,  49,  37,  24,  14,  14,  24,  37,  49,  63,  85, 107,  92,  69,  55,  41,  28,  14,   0,  14,  28,  42,  55,  74,  93, 107,  99,  81,  65,  16,  41,  58,  80,  93, 107, 108,  94,  79,  63,  48,  34,  23,  19,  27,  40,  55,  70,  86, 101, 115, 116, 116, 117, 120, 121,  94,  84,  74,  63,  54,  48,  45,  46,  51,  58,  68,  79,  91, 115, 112, 109, 108, 108 }, \
+    { 119, 106,  94,  81,  69,  58,  48,  40,  37,  38,  44,  53,  63,  81, 100, 113,  97,  83,  70,  57,  45,  34,  26,  25,  30,  39,  51,  64,  80,  96, 109,  90,  77,  63,  50,  37,  24,  14,  14,  24,  36,  49,  72,  93, 106,  83,  69,  55,  42,  28,  14,   0,  14,  28,  41,  60,  79,  93, 113,  95,  78,  28,  28,  44,  67,  79,  93, 122, 108,  92,  77,  61,  47,  33,  21,  19,  29,  42,  57,  72,  88, 101, 102, 102, 103, 106, 108,  82,  72,  63,  54,  48,  45,  46,  51,  58,  68,  79,  91, 104, 128, 125, 123, 122, 122 }, \
+    { 133, 119, 107,  94,  81,  69,  58,  48,  41,  37,  38,  44,  53,  69,  87, 127, 110,  97,  83,  70,  57,  45,  34,  27,  25,  30,  39,  51,  66,  82, 123, 104,  90,  77,  64,  50,  37,  24,  14,  14,  23,  36,  58,  80, 120,  97,  83,  69,  56,  42,  28,  14,   0,  14,  27,  46,  65,  79, 127, 109,  92,  41,  16,  31,  53,  66,  79, 136, 122, 106,  91,  75,  60,  45,  30,  20,  20,  30,  44,  59,  74,  87,  88,  88,  90,  93,  96,  71,  62,  54,  48,  45,  46,  51,  58,  68,  79,  91, 104, 117, 141, 139, 137, 136, 136 }, \
+    { 146, 133, 120, 107,  94,  81,  69,  58,  48,  41,  37,  38,  44,  58,  74, 141, 124, 110,  97,  83,  70,  57,  45,  35,  27,  25,  30,  39,  54,  69, 137, 118, 104,  90,  78,  64,  50,  37,  24,  14,  14,  23,  44,  66, 134, 111,  97,  83,  70,  56,  42,  28,  14,   0,  13,  32,  51,  65, 141, 123, 106,  55,  12,  19,  39,  52,  66, 150, 136, 120, 104,  89,  73,  58,  42,  29,  19,  21,  32,  46,  61,  74,  74,  74,  76,  80,  83,  60,  53,  48,  45,  46,  51,  58,  68,  79,  91, 104, 117, 130, 155, 153, 151, 150, 150 }, \
+    { 159, 145, 133, 119, 106,  93,  80,  68,  58,  48,  40,  37,  38,  48,  63, 154, 137, 123, 109,  96,  82,  69,  56,  45,  34,  26,  25,  30,  43,  57, 150, 131, 117, 103,  90,  77,  63,  49,  36,  23,  14,  14,  32,  53, 147, 124, 110,  96,  83,  69,  55,  41,  27,  13,   0,  19,  38,  52, 154, 136, 119,  68,  19,  12,  27,  39,  53, 162, 149, 133, 117, 101,  86,  70,  54,  39,  26,  19,  23,  34,  48,  61,  61,  61,  63,  68,  73,  53,  47,  45,  46,  51,  58,  68,  79,  90, 103, 116, 129, 142, 167, 165, 164, 163, 163 }, \
+    { 177, 164, 151, 138, 124, 111,  98,  85,  73,  62,  51,  43,  37,  39,  49, 172, 156, 142, 128, 114, 101,  87,  74,  62,  49,  38,  29,  25,  29,  41, 169, 150, 136, 122, 109,  95,  82,  68,  54,  41,  29,  17,  17,  35, 166, 143, 129, 115, 102,  88,  74,  60,  46,  32,  19,   0,  19,  33, 173, 155, 138,  86,  36,  20,  13,  22,  35, 181, 168, 152, 136, 120, 104,  89,  72,  57,  42,  29,  19,  21,  32,  43,  42,  42,  46,  52,  58,  45,  45,  47,  53,  62,  72,  83,  95, 107, 120, 133, 147, 160, 186, 184, 182, 182, 182 }, \
+    { 196, 182, 170, 156, 142, 129, 116, 102,  90,  78,  66,  55,  45,  37,  39, 191, 174, 160, 147, 133, 119, 105,  92,  80,  66,  54,  42,  32,  25,  28, 188, 169, 155, 141, 128, 114, 100,  86,  73,  59,  46,  33,  15,  19, 185, 162, 148, 134, 121, 107,  93,  79,  65,  51,  38,  19,   0,  14, 192, 174, 157, 105,  54,  37,  17,  12,  18, 200, 186, 171, 155, 139, 123, 107,  91,  75,  60,  45,  31,  21,  20,  27,  23,  23,  29,  38,  47,  46,  50,  56,  65,  76,  88,  99, 112, 125, 138, 151, 165, 178, 204, 203, 201, 201, 201 }, \
+    { 210, 196, 183, 170, 156, 142, 129, 116, 103,  90,  78,  66,  55,  42,  37, 205, 188, 174, 160, 147, 133, 119, 105,  93,  80,  66,  54,  42,  30,  25, 202, 183, 169, 155, 142, 128, 114, 100,  86,  73,  60,  46,  25,  13, 199, 176, 162, 148, 135, 121, 107,  93,  79,  65,  52,  33,  14,   0, 206, 188, 171, 119,  68,  51,  29,  18,  12, 214, 200, 184, 169, 153, 137, 121, 104,  89,  73,  58,  43,  29,  20,  19,  10,  10,  21,  32,  43,  51,  57,  65,  76,  88, 100, 112, 125, 138, 151, 165, 178, 192, 218, 217, 215, 215, 215 }, \
+    {  49,  50,  55,  63,  72,  83,  95, 107, 119, 132, 145, 158, 172, 192, 211,  37,  41,  49,  59,  71,  83,  96, 109, 121, 135, 148, 162, 175, 192, 209,  25,  33,  44,  56,  68,  81,  95, 108, 122, 136, 149, 162, 185, 207,  13,  32,  45,  59,  72,  85,  99, 113, 127, 141, 154, 173, 192, 206,   0,  18,  35,  87, 139, 156, 179, 192, 206,  10,   9,  23,  38,  54,  70,  86, 103, 119, 135, 151, 167, 183, 199, 213, 215, 215, 217, 219, 219, 190, 179, 167, 154, 141, 129, 117, 105,  94,  83,  73,  65,  60,  55,  43,  32,  20,  10 }, \
+    {  52,  49,  49,  53,  60,  70,  80,  92, 103, 115, 128, 141, 154, 175, 194,  40,  37,  39,  47,  56,  67,  80,  92, 104, 117, 131, 144, 158, 174, 191,  28,  25,  31,  41,  52,  65,  78,  91, 105, 118, 131, 145, 167, 189,  16,  16,  28,  41,  54,  68,  81,  95, 109, 123, 136, 155, 174, 188,  18,   0,  17,  69, 121, 138, 161, 174, 188,  26,  13,   8,  21,  36,  52,  68,  85, 101, 117, 133, 149, 165, 181, 195, 197, 197, 199, 201, 202, 173, 162, 151, 138, 125, 113, 102,  91,  80,  71,  63,  58,  57,  60,  50,  41,  32,  27 }, \
+    {  60,  53,  49,  49,  52,  59,  67,  78,  88, 100, 113, 125, 138, 158, 177,  49,  40,  37,  38,  45,  54,  65,  77,  89, 101, 115, 128, 141, 158, 174,  39,  27,  25,  29,  38,  49,  62,  75,  88, 102, 114, 128, 151, 172,  30,  13,  15,  25,  37,  51,  65,  78,  92, 106, 119, 138, 157, 171,  35,  17,   0,  52, 104, 121, 144, 157, 171,  43,  29,  14,   7,  20,  35,  51,  68,  84, 100, 116, 132, 148, 164, 178, 180, 180, 182, 185, 186, 157, 146, 135, 123, 110,  99,  88,  78,  69,  62,  58,  57,  59,  69,  61,  53,  47,  44 }, \
+    { 100,  88,  78,  67,  59,  52,  49,  49,  53,  60,  70,  80,  92, 110, 128,  92,  77,  65,  54,  45,  38,  37,  40,  47,  56,  67,  80,  92, 108, 124,  86,  68,  55,  43,  33,  26,  25,  31,  41,  53,  65,  78, 100, 121,  80,  58,  44,  31,  20,  12,  16,  28,  41,  55,  68,  86, 105, 119,  87,  69,  52,   0,  52,  69,  92, 105, 119,  95,  81,  65,  49,  33,  18,   7,  17,  32,  48,  64,  80,  96, 112, 126, 128, 129, 131, 135, 137, 110, 100,  91,  80,  71,  63,  59,  57,  58,  62,  69,  78,  88, 109, 105, 100,  97,  96 }, \
+    { 148, 135, 123, 110,  98,  86,  75,  65,  57,  51,  49,  50,  55,  67,  83, 141, 125, 112,  99,  86,  73,  62,  51,  43,  38,  37,  41,  49,  62,  76, 137, 118, 105,  91,  79,  65,  53,  41,  31,  25,  26,  33,  51,  71, 132, 109,  95,  81,  69,  55,  41,  28,  16,  12,  19,  36,  54,  68, 139, 121, 104,  52,   0,  17,  40,  53,  67, 147, 133, 117, 101,  85,  69,  53,  36,  21,   8,  13,  28,  44,  60,  74,  76,  78,  82,  87,  92,  71,  64,  60,  57,  57,  61,  67,  75,  85,  96, 108, 120, 132, 156, 154, 151, 149, 148 }, \
+    { 164, 151, 138, 125, 113, 100,  88,  77,  67,  59,  52,  49,  49,  57,  70, 158, 141, 128, 115, 101,  89,  76,  64,  54,  45,  38,  37,  40,  49,  62, 154, 135, 121, 107,  95,  81,  68,  55,  43,  33,  26,  25,  37,  55, 149, 126, 112,  98,  85,  72,  58,  44,  31,  19,  12,  20,  37,  51, 156, 138, 121,  69,  17,   0,  23,  36,  50, 164, 150, 134, 118, 102,  86,  70,  53,  37,  22,   8,  13,  27,  43,  57,  59,  61,  66,  73,  79,  62,  58,  57,  58,  62,  69,  77,  87,  99, 110, 123, 135, 148, 172, 170, 167, 165, 165 }, \
+    { 186, 173, 160, 147, 134, 121, 108,  96,  85,  74,  64,  56,  50,  49,  55, 180, 164, 150, 137, 123, 110,  97,  84,  73,  61,  50,  42,  37,  38,  45, 176, 157, 144, 130, 117, 104,  90,  77,  64,  51,  40,  30,  25,  36, 172, 149, 135, 121, 108,  94,  80,  67,  53,  39,  27,  13,  17,  29, 179, 161, 144,  92,  40,  23,   0,  13,  27, 187, 173, 157, 141, 125, 109,  93,  76,  60,  44,  28,  13,   8,  21,  34,  36,  40,  47,  56,  64,  57,  57,  60,  66,  75,  84,  95, 106, 118, 131, 143, 156, 169, 194, 192, 190, 188, 188 }, \
+    { 199, 185, 173, 159, 146, 133, 120, 107,  96,  84,  73,  63,  55,  49,  50, 193, 176, 163, 149, 136, 122, 109,  96,  84,  72,  60,  50,  42,  37,  39, 189, 170, 157, 143, 130, 116, 103,  89,  76,  63,  51,  39,  26,  28, 185, 162, 148, 134, 121, 107,  93,  79,  66,  52,  39,  22,  12,  18, 192, 174, 157, 105,  53,  36,  13,   0,  14, 200, 186, 170, 154, 138, 122, 106,  89,  73,  57,  41,  25,  11,   9,  21,  23,  29,  38,  48,  58,  57,  61,  66,  74,  84,  95, 105, 117, 130, 142, 155, 168, 182, 207, 205, 203, 201, 201 }, \
+    { 212, 199, 186, 173, 159, 146, 133, 120, 108,  96,  84,  73,  63,  52,  49, 207, 190, 176, 163, 149, 136, 122, 109,  97,  84,  72,  60,  50,  40,  37, 203, 184, 170, 157, 144, 130, 116, 103,  89,  76,  64,  51,  33,  25, 199, 176, 162, 148, 135, 121, 107,  93,  79,  66,  53,  35,  18,  12, 206, 188, 171, 119,  67,  50,  27,  14,   0, 214, 200, 184, 168, 152, 136, 120, 103,  87,  71,  55,  39,  24,   9,   9,  10,  20,  32,  43,  55,  61,  67,  74,  84,  95, 106, 117, 130, 142, 155, 168, 182, 195, 220, 219, 217, 215, 215 }, \
+}
+
+//Angle from each key LED to every LED, 256 per full turn
+#define LED_HIT_ANGLE { \
+    {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 202, 234, 242, 246, 248, 250, 251, 251, 252, 252, 253, 253, 253, 253, 254, 200, 224, 233, 238, 242, 244, 246, 247, 248, 249, 249, 250, 251, 251, 201, 220, 228, 233, 237, 239, 242, 243, 245, 246, 246, 247, 248, 249, 193, 207, 218, 235, 242, 244, 245, 246, 247, 187, 197, 208, 217, 224, 229, 233, 236, 238, 240, 242, 243, 244, 245, 246, 248, 250, 253, 255,   1,   2,   2,   2,   2,   2,   3,   3,   4,   4,   5,   7,   9,  16,  99, 154, 175, 182, 185 }, \
+    { 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 162, 211, 234, 242, 246, 248, 250, 251, 251, 252, 252, 253, 253, 253, 253, 177, 208, 224, 233, 238, 242, 244, 246, 247, 248, 249, 249, 250, 251, 185, 210, 220, 228, 233, 237, 239, 242, 243, 245, 246, 247, 248, 248, 181, 196, 209, 232, 241, 243, 244, 245, 246, 177, 187, 198, 209, 218, 224, 229, 233, 236, 238, 240, 242, 243, 244, 245, 247, 250, 252, 255,   1,   2,   2,   2,   2,   3,   3,   4,   4,   5,   7,   9,  16,  38, 117, 139, 156, 167, 173 }, \
+    { 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 147, 170, 214, 235, 243, 246, 248, 250, 251, 251, 252, 252, 253, 253, 253, 162, 187, 210, 225, 233, 238, 242, 244, 246, 247, 248, 249, 250, 251, 173, 196, 210, 221, 228, 233, 237, 240, 242, 243, 245, 246, 247, 248, 172, 185, 199, 228, 239, 241, 243, 244, 245, 169, 178, 189, 201, 211, 219, 225, 230, 234, 237, 239, 241, 242, 243, 244, 247, 249, 252, 255,   1,   2,   2,   2,   3,   3,   4,   4,   5,   7,   9,  15,  35,  93, 121, 135, 147, 158, 164 }, \
+    { 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 140, 149, 170, 214, 235, 243, 246, 248, 250, 251, 251, 252, 252, 253, 253, 152, 167, 187, 210, 224, 233, 238, 242, 244, 246, 247, 248, 249, 250, 162, 181, 196, 210, 220, 228, 233, 237, 240, 242, 243, 245, 246, 247, 164, 175, 188, 223, 237, 240, 242, 243, 244, 163, 170, 179, 191, 202, 212, 220, 226, 231, 234, 237, 239, 241, 242, 243, 246, 249, 252, 255,   1,   2,   3,   3,   3,   4,   4,   5,   7,   9,  15,  35,  93, 113, 123, 133, 142, 151, 157 }, \
+    { 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 137, 141, 149, 170, 214, 235, 243, 246, 248, 250, 251, 251, 252, 252, 253, 146, 155, 167, 187, 208, 224, 233, 238, 242, 244, 246, 247, 249, 250, 155, 169, 181, 196, 210, 220, 228, 233, 237, 240, 242, 244, 245, 246, 158, 166, 177, 216, 235, 238, 241, 242, 243, 158, 163, 171, 181, 192, 203, 213, 221, 227, 231, 235, 237, 239, 241, 242, 245, 248, 251, 254,   2,   3,   3,   3,   4,   4,   5,   7,   9,  15,  35,  93, 113, 119, 124, 132, 139, 147, 152 }, \
+    { 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 135, 138, 141, 149, 170, 214, 235, 243, 246, 248, 250, 251, 251, 252, 252, 143, 148, 155, 167, 185, 208, 224, 233, 238, 242, 244, 246, 248, 249, 150, 159, 169, 181, 195, 210, 220, 228, 233, 237, 239, 242, 244, 245, 153, 160, 168, 207, 231, 235, 239, 241, 242, 154, 158, 164, 172, 182, 193, 205, 215, 222, 228, 232, 235, 238, 240, 241, 244, 248, 251, 254,   2,   3,   3,   4,   4,   5,   7,   9,  15,  35,  93, 113, 119, 121, 125, 131, 137, 144, 149 }, \
+    { 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0, 134, 136, 138, 141, 149, 170, 214, 235, 242, 246, 248, 250, 251, 251, 252, 140, 144, 148, 155, 166, 185, 208, 224, 233, 238, 242, 244, 247, 248, 147, 153, 159, 169, 180, 195, 210, 220, 228, 233, 237, 240, 243, 244, 150, 155, 161, 196, 227, 232, 237, 239, 241, 150, 154, 159, 165, 173, 183, 195, 207, 216, 223, 228, 232, 235, 238, 240, 243, 247, 251, 254,   2,   3,   4,   4,   5,   7,   9,  15,  35,  93, 113, 119, 121, 123, 125, 131, 136, 141, 146 }, \
+    { 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0, 133, 134, 136, 138, 141, 149, 170, 214, 234, 242, 246, 248, 250, 251, 252, 138, 141, 144, 148, 154, 166, 185, 208, 224, 233, 238, 242, 245, 247, 144, 149, 153, 159, 168, 180, 195, 210, 220, 228, 233, 238, 241, 243, 147, 151, 156, 185, 221, 228, 234, 237, 239, 148, 151, 154, 159, 166, 174, 185, 197, 208, 217, 224, 229, 233, 236, 238, 242, 246, 250, 254,   2,   4,   4,   5,   7,   9,  16,  35,  93, 113, 119, 121, 123, 124, 126, 130, 135, 140, 144 }, \
+    { 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0, 133, 133, 134, 136, 138, 142, 150, 173, 214, 235, 243, 246, 248, 250, 251, 137, 139, 141, 144, 148, 155, 167, 187, 210, 225, 233, 238, 243, 246, 142, 146, 149, 154, 159, 169, 181, 196, 210, 221, 228, 235, 239, 241, 145, 148, 152, 175, 214, 223, 231, 234, 237, 146, 148, 151, 155, 160, 167, 176, 188, 199, 210, 218, 225, 230, 233, 236, 240, 244, 249, 254,   2,   4,   5,   7,   9,  15,  35,  90, 112, 119, 121, 123, 124, 124, 126, 130, 134, 138, 142 }, \
+    { 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0, 132, 133, 133, 134, 136, 138, 142, 150, 170, 214, 235, 243, 246, 249, 250, 136, 138, 139, 141, 144, 148, 155, 167, 187, 210, 224, 233, 241, 245, 141, 143, 146, 149, 153, 159, 169, 181, 196, 210, 220, 230, 236, 239, 143, 146, 149, 166, 205, 216, 227, 231, 234, 144, 146, 149, 152, 156, 161, 168, 178, 189, 201, 211, 219, 225, 230, 234, 238, 243, 248, 253,   3,   5,   7,   9,  15,  35,  93, 112, 119, 121, 123, 124, 124, 125, 126, 130, 134, 137, 141 }, \
+    { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0, 132, 132, 133, 133, 134, 136, 138, 142, 149, 170, 214, 235, 243, 247, 249, 135, 136, 138, 139, 141, 144, 148, 155, 167, 187, 208, 224, 237, 242, 139, 142, 143, 146, 149, 153, 159, 169, 181, 196, 210, 223, 232, 236, 142, 144, 146, 160, 194, 207, 221, 226, 231, 143, 144, 146, 149, 152, 156, 162, 170, 179, 191, 202, 212, 220, 226, 230, 235, 241, 247, 253,   3,   7,  10,  15,  35,  93, 113, 119, 121, 123, 124, 124, 125, 125, 126, 130, 133, 137, 140 }, \
+    { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0, 131, 132, 132, 133, 133, 134, 136, 138, 141, 149, 170, 214, 235, 244, 247, 135, 136, 136, 138, 139, 141, 144, 148, 155, 167, 185, 208, 230, 239, 138, 140, 142, 143, 146, 149, 153, 159, 169, 181, 195, 214, 226, 232, 141, 142, 144, 155, 182, 196, 213, 220, 226, 142, 143, 145, 147, 149, 153, 157, 163, 171, 181, 192, 203, 213, 221, 226, 232, 238, 245, 252,   4,  10,  16,  35,  93, 113, 119, 121, 123, 124, 124, 125, 125, 126, 126, 130, 133, 136, 139 }, \
+    { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0, 131, 131, 132, 132, 133, 133, 134, 136, 138, 141, 149, 170, 214, 237, 244, 134, 135, 136, 136, 138, 139, 141, 144, 148, 155, 166, 185, 219, 234, 137, 139, 140, 142, 143, 146, 149, 153, 159, 169, 180, 201, 218, 226, 140, 141, 143, 151, 172, 185, 203, 213, 220, 141, 142, 143, 145, 147, 150, 153, 158, 164, 172, 182, 193, 205, 214, 221, 227, 233, 242, 251,   5,  18,  41,  93, 113, 119, 121, 123, 124, 124, 125, 125, 126, 126, 127, 129, 132, 135, 138 }, \
+    { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0, 131, 131, 131, 132, 132, 132, 133, 134, 135, 137, 139, 144, 157, 202, 234, 133, 134, 135, 135, 136, 137, 138, 140, 142, 146, 150, 159, 189, 220, 136, 137, 138, 139, 141, 142, 144, 147, 151, 156, 163, 178, 199, 212, 138, 140, 141, 147, 161, 170, 186, 197, 208, 139, 140, 141, 143, 144, 146, 149, 152, 156, 162, 169, 179, 190, 201, 211, 216, 223, 233, 248,   9,  83, 109, 117, 120, 122, 123, 124, 125, 125, 125, 126, 126, 126, 127, 129, 132, 134, 137 }, \
+    { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0, 130, 131, 131, 131, 131, 132, 132, 133, 133, 134, 136, 138, 142, 153, 192, 133, 133, 134, 134, 135, 136, 136, 138, 139, 141, 144, 148, 162, 192, 135, 136, 137, 138, 139, 140, 142, 143, 146, 149, 153, 162, 177, 192, 138, 138, 139, 144, 154, 160, 171, 181, 192, 138, 139, 140, 141, 142, 144, 146, 148, 151, 155, 160, 167, 176, 187, 197, 200, 204, 211, 232,  29, 115, 119, 121, 123, 124, 124, 125, 125, 126, 126, 126, 126, 126, 127, 129, 131, 134, 136 }, \
+    {  74,  34,  19,  12,   9,   7,   6,   5,   5,   4,   4,   3,   3,   3,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 199, 235, 243, 246, 248, 250, 251, 251, 252, 252, 253, 253, 253, 254, 200, 226, 234, 239, 242, 244, 246, 247, 248, 249, 249, 250, 251, 251, 190, 209, 222, 239, 245, 246, 248, 248, 249, 183, 196, 209, 220, 227, 233, 236, 239, 241, 243, 244, 245, 246, 247, 248, 250, 252, 255,   1,   3,   5,   5,   5,   6,   6,   7,   8,   9,  11,  13,  17,  23,  35,  85, 108, 148, 171, 178 }, \
+    { 106,  83,  42,  21,  13,  10,   8,   6,   5,   5,   4,   4,   3,   3,   3, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 155, 205, 232, 241, 245, 248, 249, 250, 251, 252, 252, 253, 253, 253, 174, 209, 224, 233, 238, 241, 244, 245, 247, 248, 249, 249, 250, 251, 173, 191, 209, 236, 244, 245, 247, 247, 248, 169, 180, 195, 209, 219, 227, 232, 236, 239, 241, 243, 244, 245, 246, 247, 250, 252, 255,   1,   4,   5,   5,   6,   6,   7,   8,  10,  11,  14,  18,  25,  39,  64, 104, 119, 137, 152, 162 }, \
+    { 114, 106,  86,  42,  21,  13,  10,   8,   6,   5,   5,   4,   4,   3,   3, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 144, 164, 205, 232, 241, 245, 248, 249, 250, 251, 252, 252, 253, 253, 159, 187, 209, 224, 232, 238, 241, 244, 245, 247, 248, 249, 250, 250, 162, 176, 194, 232, 242, 244, 246, 247, 247, 161, 170, 182, 197, 210, 220, 228, 233, 237, 239, 241, 243, 244, 245, 246, 249, 252, 255,   1,   4,   5,   6,   6,   7,   8,  10,  11,  14,  18,  25,  39,  64,  89, 111, 122, 134, 145, 154 }, \
+    { 118, 114, 107,  86,  42,  21,  13,  10,   8,   6,   5,   5,   4,   4,   3, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 139, 147, 164, 205, 231, 241, 245, 248, 249, 250, 251, 252, 252, 253, 151, 168, 187, 209, 223, 232, 238, 241, 244, 245, 247, 248, 249, 250, 155, 165, 179, 226, 240, 243, 245, 246, 247, 155, 161, 171, 184, 198, 212, 222, 229, 234, 237, 240, 242, 243, 245, 246, 249, 251, 255,   1,   4,   6,   7,   7,   8,  10,  11,  14,  18,  25,  39,  64,  89, 103, 115, 124, 132, 141, 149 }, \
+    { 120, 118, 115, 107,  86,  42,  21,  13,  10,   8,   6,   5,   5,   4,   3, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136, 140, 147, 164, 202, 231, 241, 245, 248, 249, 250, 251, 252, 253, 146, 156, 168, 187, 208, 223, 232, 238, 241, 244, 245, 247, 248, 249, 150, 157, 167, 217, 238, 241, 244, 245, 246, 151, 155, 162, 172, 186, 200, 213, 223, 230, 234, 237, 240, 242, 243, 245, 248, 251, 254,   2,   5,   7,   7,   8,  10,  11,  14,  18,  25,  39,  64,  89, 103, 110, 118, 125, 131, 139, 145 }, \
+    { 122, 120, 118, 115, 107,  86,  42,  21,  14,  10,   8,   6,   5,   4,   4, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 135, 137, 140, 147, 162, 202, 231, 241, 245, 248, 249, 250, 252, 252, 142, 149, 156, 168, 186, 208, 223, 232, 238, 241, 244, 246, 247, 248, 147, 151, 158, 205, 235, 239, 242, 244, 245, 147, 151, 156, 164, 174, 187, 202, 215, 224, 230, 235, 238, 240, 242, 244, 247, 251, 254,   2,   5,   8,   8,  10,  11,  14,  18,  25,  39,  64,  89, 103, 110, 114, 119, 125, 131, 137, 142 }, \
+    { 123, 122, 120, 118, 115, 107,  86,  42,  22,  14,  10,   8,   6,   5,   4, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0, 134, 135, 137, 140, 146, 162, 202, 231, 241, 245, 248, 249, 251, 252, 140, 144, 149, 156, 167, 186, 208, 223, 232, 238, 241, 244, 246, 247, 144, 148, 152, 190, 230, 235, 240, 242, 244, 145, 148, 152, 157, 165, 175, 189, 205, 216, 225, 231, 235, 238, 240, 242, 246, 250, 254,   2,   6,   9,  10,  11,  14,  18,  26,  39,  64,  89, 103, 110, 114, 117, 121, 126, 130, 136, 140 }, \
+    { 123, 123, 122, 120, 118, 115, 107,  86,  45,  22,  14,  10,   8,   6,   5, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0, 133, 134, 135, 137, 140, 146, 162, 202, 231, 241, 245, 248, 250, 251, 138, 141, 144, 149, 155, 167, 186, 208, 223, 232, 237, 242, 245, 246, 142, 145, 148, 175, 223, 231, 238, 240, 242, 143, 145, 148, 152, 158, 166, 177, 192, 206, 218, 226, 231, 236, 238, 241, 245, 249, 254,   2,   7,  10,  12,  14,  18,  26,  41,  64,  89, 103, 110, 114, 117, 118, 121, 126, 130, 135, 139 }, \
+    { 124, 123, 123, 122, 120, 118, 114, 106,  86,  42,  21,  13,  10,   7,   5, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0, 132, 133, 134, 135, 137, 140, 147, 164, 205, 232, 241, 245, 249, 251, 137, 140, 142, 145, 149, 156, 168, 187, 209, 224, 232, 239, 243, 245, 141, 143, 145, 165, 215, 226, 234, 238, 240, 142, 144, 146, 149, 153, 159, 168, 180, 195, 209, 219, 227, 232, 236, 239, 244, 248, 254,   2,   7,  12,  14,  18,  25,  39,  64,  87, 102, 110, 114, 117, 118, 120, 122, 126, 130, 134, 138 }, \
+    { 124, 124, 123, 123, 122, 120, 118, 114, 107,  86,  42,  21,  13,   9,   6, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0, 132, 133, 133, 134, 135, 137, 140, 147, 164, 205, 231, 241, 247, 250, 136, 138, 140, 142, 144, 149, 156, 168, 187, 209, 223, 235, 240, 243, 139, 141, 143, 157, 202, 217, 230, 234, 238, 140, 142, 144, 146, 149, 154, 160, 170, 182, 197, 210, 220, 228, 233, 237, 242, 247, 253,   3,   9,  15,  19,  25,  39,  64,  89, 102, 110, 114, 117, 118, 120, 121, 123, 126, 130, 134, 137 }, \
+    { 125, 124, 124, 123, 123, 122, 120, 118, 115, 107,  86,  42,  21,  11,   8, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0, 131, 132, 133, 133, 134, 135, 137, 140, 147, 164, 202, 231, 244, 248, 135, 137, 138, 140, 141, 144, 149, 156, 168, 187, 208, 227, 236, 240, 138, 140, 141, 151, 187, 205, 223, 229, 234, 139, 141, 142, 144, 147, 150, 154, 161, 171, 184, 198, 212, 222, 229, 233, 239, 245, 253,   3,  10,  20,  27,  39,  64,  89, 103, 110, 114, 117, 118, 120, 121, 122, 123, 126, 130, 133, 136 }, \
+    { 125, 125, 124, 124, 123, 123, 122, 120, 118, 115, 107,  86,  42,  16,  10, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0, 131, 132, 132, 133, 133, 134, 135, 137, 140, 147, 162, 202, 238, 246, 135, 136, 137, 138, 139, 141, 144, 149, 156, 168, 186, 214, 230, 236, 137, 139, 140, 148, 173, 190, 213, 222, 229, 138, 139, 141, 142, 144, 147, 150, 155, 162, 172, 186, 200, 213, 223, 229, 236, 243, 252,   4,  13,  28,  42,  64,  89, 103, 110, 114, 117, 118, 120, 121, 122, 122, 124, 127, 129, 133, 135 }, \
+    { 125, 125, 125, 124, 124, 123, 123, 122, 120, 118, 115, 107,  86,  29,  14, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0, 131, 131, 132, 132, 133, 133, 134, 135, 137, 140, 146, 162, 224, 242, 134, 135, 136, 137, 138, 139, 141, 144, 149, 156, 167, 194, 219, 230, 137, 138, 139, 145, 162, 175, 200, 212, 222, 138, 139, 140, 141, 143, 145, 147, 151, 156, 164, 174, 187, 202, 214, 223, 231, 239, 250,   6,  17,  45,  68,  89, 103, 110, 114, 117, 118, 120, 121, 122, 122, 123, 124, 127, 129, 132, 135 }, \
+    { 125, 125, 125, 125, 124, 124, 123, 123, 122, 121, 119, 116, 109,  74,  25, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0, 131, 131, 131, 132, 132, 132, 133, 134, 135, 137, 139, 144, 176, 231, 134, 134, 135, 136, 137, 138, 139, 141, 144, 148, 153, 169, 197, 216, 136, 137, 138, 142, 154, 162, 181, 195, 210, 137, 138, 138, 140, 141, 142, 144, 147, 151, 156, 163, 173, 186, 201, 213, 220, 230, 247,   9,  26,  78,  95, 105, 111, 115, 117, 119, 120, 121, 122, 122, 123, 123, 124, 127, 129, 132, 134 }, \
+    { 126, 125, 125, 125, 125, 124, 124, 124, 123, 122, 121, 119, 116, 106,  64, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0, 130, 131, 131, 131, 131, 132, 132, 133, 134, 135, 136, 139, 148, 192, 133, 134, 134, 135, 135, 136, 137, 139, 140, 143, 146, 154, 171, 192, 135, 136, 137, 140, 149, 154, 166, 177, 192, 136, 137, 138, 138, 139, 141, 142, 144, 147, 151, 155, 162, 172, 186, 199, 204, 210, 232,  24,  49, 100, 107, 112, 115, 118, 119, 120, 121, 122, 122, 123, 123, 124, 125, 127, 129, 132, 134 }, \
+    {  72,  49,  34,  24,  18,  15,  12,  10,   9,   8,   7,   7,   6,   5,   5,  71,  27,  16,  11,   8,   7,   6,   5,   4,   4,   3,   3,   3,   3,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 201, 237, 243, 246, 248, 250, 250, 251, 252, 252, 252, 253, 253, 253, 186, 213, 228, 244, 249, 249, 250, 251, 251, 177, 195, 213, 225, 233, 238, 241, 243, 245, 246, 247, 248, 249, 249, 250, 252, 255,   1,   3,   6,   7,   8,   8,   9,  10,  11,  13,  15,  17,  21,  26,  34,  46,  80,  89, 110, 148, 168 }, \
+    {  96,  80,  59,  39,  27,  20,  16,  13,  11,  10,   8,   8,   7,   6,   5, 107,  77,  36,  19,  12,   9,   7,   6,   5,   5,   4,   4,   3,   3,   3, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156, 212, 233, 242, 245, 248, 249, 250, 251, 252, 252, 252, 253, 253, 162, 184, 210, 241, 247, 248, 250, 250, 250, 160, 172, 191, 210, 223, 232, 237, 240, 243, 245, 246, 247, 248, 249, 249, 252, 255,   1,   4,   6,   8,   9,   9,  11,  12,  14,  16,  18,  22,  29,  38,  52,  69,  97, 107, 120, 137, 150 }, \
+    { 105,  96,  82,  59,  39,  27,  20,  16,  13,  11,  10,   8,   8,   7,   6, 115, 104,  77,  36,  19,  12,   9,   7,   6,   5,   5,   4,   4,   3,   3, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 145, 172, 212, 233, 241, 245, 248, 249, 250, 251, 251, 252, 253, 253, 152, 166, 189, 237, 246, 248, 249, 249, 250, 153, 161, 174, 193, 212, 225, 232, 238, 241, 243, 245, 246, 247, 248, 249, 252, 254,   1,   4,   7,   9,  10,  11,  12,  14,  16,  18,  22,  29,  38,  52,  69,  85, 104, 113, 123, 134, 144 }, \
+    { 110, 105,  97,  82,  59,  39,  27,  20,  16,  13,  11,  10,   8,   7,   6, 118, 113, 104,  77,  36,  19,  12,   9,   7,   6,   5,   5,   4,   4,   3, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 140, 151, 172, 212, 233, 241, 245, 248, 249, 250, 251, 252, 252, 253, 147, 154, 169, 231, 245, 246, 248, 249, 249, 148, 153, 162, 176, 196, 214, 226, 234, 238, 241, 243, 245, 246, 247, 248, 251, 254,   1,   4,   7,  10,  11,  12,  14,  16,  19,  22,  29,  38,  52,  69,  85,  96, 109, 116, 124, 133, 140 }, \
+    { 114, 110, 105,  96,  80,  57,  38,  26,  20,  16,  13,  11,  10,   8,   7, 120, 117, 113, 103,  74,  34,  18,  12,   9,   7,   6,   5,   5,   4,   3, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 137, 143, 151, 174, 212, 233, 242, 245, 248, 249, 250, 251, 252, 252, 143, 148, 157, 222, 243, 245, 247, 248, 249, 145, 149, 155, 164, 180, 200, 217, 228, 235, 239, 242, 244, 245, 247, 248, 251, 254,   2,   5,   8,  11,  12,  13,  16,  18,  22,  28,  37,  51,  68,  84,  95, 103, 112, 118, 125, 132, 138 }, \
+    { 116, 114, 110, 105,  96,  80,  57,  38,  27,  20,  16,  13,  11,   9,   8, 122, 120, 117, 113, 103,  74,  34,  18,  12,   9,   7,   6,   5,   4,   4, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0, 135, 139, 143, 151, 172, 212, 233, 242, 245, 248, 249, 250, 251, 252, 141, 144, 149, 206, 240, 243, 246, 247, 248, 142, 145, 149, 155, 166, 182, 202, 219, 229, 235, 239, 242, 244, 245, 247, 250, 254,   2,   5,   9,  12,  14,  16,  18,  22,  29,  37,  51,  68,  84,  95, 103, 108, 114, 120, 125, 131, 137 }, \
+    { 118, 116, 114, 110, 105,  96,  80,  57,  39,  27,  20,  16,  13,  10,   8, 123, 121, 120, 117, 113, 103,  74,  34,  19,  12,   9,   7,   6,   5,   4, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0, 134, 136, 139, 143, 151, 172, 212, 233, 242, 245, 248, 250, 251, 251, 139, 141, 145, 184, 236, 241, 245, 246, 247, 140, 143, 145, 150, 157, 167, 184, 205, 221, 230, 236, 240, 242, 244, 246, 250, 254,   2,   6,  10,  14,  16,  18,  22,  29,  38,  51,  68,  84,  95, 103, 108, 111, 116, 121, 126, 131, 136 }, \
+    { 119, 118, 116, 114, 110, 105,  96,  80,  59,  39,  27,  20,  16,  12,  10, 123, 122, 121, 120, 117, 113, 103,  74,  36,  19,  12,   9,   7,   6,   5, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0, 133, 135, 136, 139, 142, 151, 172, 212, 233, 242, 245, 248, 250, 251, 137, 139, 142, 166, 230, 237, 243, 244, 246, 139, 141, 143, 146, 150, 158, 169, 188, 208, 222, 231, 236, 240, 242, 245, 249, 253,   2,   7,  11,  16,  19,  22,  29,  38,  52,  68,  84,  95, 103, 108, 111, 114, 118, 122, 126, 130, 135 }, \
+    { 120, 119, 118, 116, 114, 110, 105,  96,  82,  59,  39,  27,  20,  14,  11, 124, 123, 122, 121, 120, 117, 113, 103,  77,  36,  19,  12,   9,   7,   6, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0, 133, 134, 135, 136, 139, 142, 151, 172, 212, 233, 241, 246, 249, 250, 136, 138, 140, 154, 218, 231, 240, 242, 244, 138, 139, 141, 143, 146, 151, 159, 172, 191, 210, 223, 232, 237, 240, 243, 248, 253,   3,   8,  13,  19,  23,  29,  38,  52,  69,  84,  95, 103, 108, 111, 114, 115, 119, 122, 126, 130, 134 }, \
+    { 121, 120, 119, 118, 116, 114, 110, 105,  97,  82,  59,  39,  27,  18,  13, 124, 124, 123, 122, 121, 120, 117, 113, 104,  77,  36,  19,  12,   9,   7, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0, 132, 133, 134, 135, 136, 139, 142, 151, 172, 212, 233, 243, 247, 249, 136, 137, 138, 148, 200, 221, 235, 239, 242, 137, 138, 139, 141, 144, 147, 152, 161, 174, 193, 212, 225, 232, 237, 241, 247, 252,   3,   9,  15,  24,  30,  38,  52,  69,  85,  95, 103, 108, 111, 114, 115, 117, 120, 123, 126, 130, 133 }, \
+    { 121, 121, 120, 119, 118, 116, 114, 110, 105,  96,  80,  57,  38,  22,  16, 125, 124, 124, 123, 122, 121, 120, 117, 113, 103,  74,  34,  18,  11,   8, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0, 132, 133, 133, 134, 135, 136, 139, 143, 151, 174, 212, 237, 245, 247, 135, 136, 137, 144, 179, 206, 229, 235, 240, 136, 137, 138, 140, 142, 144, 148, 154, 163, 177, 197, 215, 226, 234, 238, 245, 252,   4,  11,  17,  30,  39,  51,  68,  84,  95, 102, 107, 111, 113, 115, 117, 118, 120, 123, 126, 130, 133 }, \
+    { 122, 121, 121, 120, 119, 118, 116, 114, 110, 105,  96,  80,  57,  31,  20, 125, 125, 124, 124, 123, 122, 121, 120, 117, 113, 103,  74,  34,  16,  11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0, 131, 132, 133, 133, 134, 135, 136, 139, 143, 151, 172, 222, 240, 245, 134, 135, 136, 141, 163, 184, 217, 228, 235, 135, 136, 137, 138, 140, 142, 144, 149, 155, 164, 180, 200, 217, 227, 234, 242, 251,   5,  13,  21,  40,  53,  68,  84,  95, 103, 107, 111, 113, 115, 117, 118, 119, 121, 124, 127, 130, 133 }, \
+    { 123, 122, 122, 121, 121, 120, 119, 117, 115, 113, 109, 102,  91,  61,  34, 125, 125, 125, 124, 124, 124, 123, 122, 121, 119, 116, 110,  96,  48,  20, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0, 131, 131, 132, 132, 133, 133, 134, 135, 137, 140, 145, 163, 214, 234, 134, 134, 135, 138, 149, 158, 184, 205, 221, 135, 135, 136, 137, 138, 139, 141, 143, 147, 152, 159, 172, 191, 210, 223, 234, 247,   8,  21,  33,  67,  81,  92, 101, 106, 110, 113, 115, 116, 118, 119, 119, 120, 122, 124, 127, 129, 132 }, \
+    { 123, 123, 123, 122, 122, 121, 120, 119, 118, 117, 114, 111, 106,  92,  64, 126, 125, 125, 125, 125, 124, 124, 123, 123, 122, 120, 118, 114, 103,  64, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0, 131, 131, 131, 132, 132, 132, 133, 134, 135, 136, 138, 143, 158, 192, 133, 133, 134, 136, 143, 147, 158, 171, 192, 134, 134, 135, 136, 136, 137, 139, 140, 142, 145, 149, 156, 167, 183, 201, 210, 229,  24,  45,  55,  90,  98, 104, 109, 112, 114, 116, 117, 118, 119, 120, 121, 121, 122, 125, 127, 129, 132 }, \
+    {  73,  57,  45,  34,  27,  22,  19,  16,  14,  13,  11,  10,   9,   8,   7,  72,  46,  31,  23,  18,  14,  12,  10,   9,   8,   7,   7,   6,   6,   5,  73,  28,  17,  12,   9,   7,   6,   5,   5,   4,   4,   3,   3,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 170, 222, 240, 250, 252, 253, 253, 253, 254, 164, 190, 219, 234, 240, 244, 246, 248, 249, 250, 251, 251, 252, 252, 252, 255,   1,   4,   6,   8,  10,  11,  12,  13,  14,  16,  18,  20,  24,  28,  34,  43,  53,  78,  83,  93, 113, 143 }, \
+    {  92,  82,  68,  53,  41,  31,  25,  21,  18,  15,  14,  12,  11,   9,   8,  98,  81,  59,  40,  28,  21,  16,  13,  12,  10,   9,   8,   7,   6,   6, 109,  84,  44,  23,  15,  11,   8,   7,   6,   5,   5,   4,   3,   3, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 144, 160, 208, 248, 252, 252, 253, 253, 253, 146, 155, 176, 208, 229, 238, 243, 246, 247, 249, 250, 250, 251, 251, 252, 255,   1,   4,   7,   9,  12,  13,  14,  15,  17,  20,  23,  27,  32,  39,  49,  61,  74,  93, 101, 110, 122, 134 }, \
+    { 100,  92,  82,  68,  53,  41,  31,  25,  21,  18,  15,  14,  12,  10,   9, 106,  96,  81,  59,  40,  28,  21,  16,  14,  12,  10,   9,   8,   7,   6, 115, 105,  84,  44,  23,  15,  11,   8,   7,   6,   5,   5,   4,   3, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 139, 146, 166, 245, 251, 252, 252, 253, 253, 142, 147, 157, 180, 212, 230, 239, 243, 246, 248, 249, 250, 250, 251, 252, 255,   1,   5,   7,  10,  13,  14,  15,  17,  20,  23,  27,  32,  39,  49,  61,  74,  85, 100, 106, 114, 123, 133 }, \
+    { 105, 100,  93,  82,  68,  53,  41,  31,  26,  21,  18,  15,  14,  11,  10, 111, 105,  96,  81,  59,  40,  28,  21,  17,  14,  12,  10,   9,   8,   7, 118, 114, 105,  84,  46,  23,  15,  11,   8,   7,   6,   5,   4,   4, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136, 140, 148, 240, 250, 251, 252, 252, 253, 139, 142, 148, 159, 184, 215, 232, 240, 244, 246, 248, 249, 250, 251, 251, 254,   2,   5,   8,  11,  14,  16,  17,  20,  23,  27,  32,  39,  49,  61,  74,  85,  93, 104, 110, 117, 124, 132 }, \
+    { 109, 105, 100,  92,  82,  67,  52,  40,  31,  25,  21,  18,  15,  13,  11, 114, 110, 104,  95,  80,  58,  39,  27,  21,  16,  13,  11,  10,   9,   7, 120, 117, 113, 105,  84,  44,  23,  14,  11,   8,   7,   6,   5,   4, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 135, 137, 141, 230, 249, 250, 251, 252, 252, 137, 140, 143, 149, 162, 190, 219, 234, 241, 244, 246, 248, 249, 250, 251, 254,   2,   5,   9,  12,  16,  17,  19,  23,  27,  32,  39,  48,  60,  73,  84,  93,  99, 108, 113, 118, 125, 131 }, \
+    { 111, 109, 105, 100,  92,  82,  67,  52,  41,  31,  25,  21,  18,  14,  12, 116, 113, 110, 104,  95,  80,  58,  39,  28,  21,  16,  13,  11,  10,   8, 122, 120, 117, 113, 105,  84,  44,  23,  14,  11,   8,   7,   5,   4, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0, 134, 135, 138, 199, 247, 249, 251, 251, 252, 136, 138, 140, 144, 150, 165, 194, 223, 235, 241, 245, 247, 248, 249, 250, 254,   2,   6,  10,  13,  18,  20,  23,  27,  32,  39,  48,  60,  73,  84,  93,  99, 104, 110, 115, 120, 125, 131 }, \
+    { 114, 111, 109, 105, 100,  92,  82,  67,  53,  41,  31,  25,  21,  16,  14, 118, 116, 113, 110, 104,  95,  80,  58,  40,  28,  21,  16,  13,  11,   9, 122, 121, 120, 117, 114, 105,  84,  44,  23,  14,  11,   8,   6,   5, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0,   0, 133, 134, 136, 160, 244, 248, 250, 251, 251, 135, 136, 138, 140, 144, 152, 168, 200, 225, 236, 242, 245, 247, 248, 250, 254,   2,   7,  11,  15,  20,  23,  27,  32,  39,  49,  60,  73,  84,  93,  99, 104, 107, 112, 117, 121, 126, 130 }, \
+    { 115, 114, 112, 109, 105, 100,  92,  82,  68,  53,  41,  31,  25,  19,  15, 119, 117, 116, 113, 110, 104,  95,  80,  59,  40,  28,  21,  16,  13,  11, 123, 122, 121, 120, 117, 114, 105,  84,  44,  23,  15,  11,   7,   6, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0,   0, 132, 133, 134, 146, 238, 245, 249, 250, 251, 134, 135, 136, 138, 141, 145, 153, 172, 204, 227, 237, 242, 245, 247, 249, 254,   2,   8,  12,  17,  24,  27,  32,  39,  49,  61,  73,  84,  93,  99, 104, 107, 110, 114, 118, 122, 126, 130 }, \
+    { 117, 115, 114, 112, 109, 105, 100,  92,  82,  68,  53,  41,  31,  23,  18, 120, 119, 117, 116, 113, 110, 104,  95,  81,  59,  40,  28,  21,  16,  12, 124, 123, 122, 121, 120, 117, 114, 105,  84,  44,  23,  15,   9,   7, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0,   0, 132, 132, 133, 140, 224, 240, 247, 249, 250, 133, 134, 135, 137, 138, 141, 146, 155, 176, 208, 229, 238, 243, 245, 248, 253,   3,   9,  14,  19,  28,  33,  39,  49,  61,  74,  84,  93,  99, 104, 107, 110, 112, 115, 119, 122, 126, 130 }, \
+    { 118, 117, 115, 114, 112, 109, 105, 100,  93,  82,  68,  53,  41,  28,  21, 121, 120, 119, 117, 116, 113, 110, 104,  96,  81,  59,  40,  28,  20,  15, 124, 124, 123, 122, 121, 120, 117, 114, 105,  84,  46,  23,  12,   8, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0,   0, 131, 132, 133, 137, 185, 229, 244, 247, 249, 133, 134, 134, 135, 137, 139, 142, 147, 157, 180, 212, 230, 239, 243, 246, 253,   3,  10,  16,  22,  34,  41,  49,  61,  74,  85,  93,  99, 104, 107, 110, 112, 114, 117, 120, 123, 126, 130 }, \
+    { 118, 118, 117, 115, 114, 111, 109, 105, 100,  92,  82,  67,  52,  35,  25, 121, 121, 120, 119, 117, 116, 113, 109, 104,  95,  80,  58,  39,  25,  18, 124, 124, 123, 123, 122, 121, 120, 117, 113, 105,  84,  44,  17,  10, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0,   0, 131, 132, 132, 135, 155, 199, 238, 244, 247, 133, 133, 134, 135, 136, 137, 139, 143, 148, 160, 186, 216, 232, 240, 244, 252,   4,  12,  19,  26,  41,  50,  60,  73,  84,  93,  99, 103, 107, 110, 112, 113, 115, 117, 120, 123, 127, 129 }, \
+    { 119, 119, 118, 117, 116, 114, 112, 110, 107, 102,  95,  86,  73,  50,  34, 122, 121, 121, 120, 119, 118, 116, 114, 111, 107,  99,  86,  66,  41,  26, 125, 124, 124, 124, 123, 122, 122, 120, 118, 115, 109,  94,  35,  15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0,   0, 131, 131, 132, 134, 142, 153, 211, 233, 242, 132, 133, 133, 134, 134, 135, 137, 139, 142, 147, 157, 180, 212, 230, 239, 250,   6,  17,  26,  33,  56,  67,  77,  87,  95, 101, 105, 108, 110, 112, 114, 115, 116, 118, 121, 124, 127, 129 }, \
+    { 120, 120, 119, 118, 117, 116, 115, 113, 111, 108, 104,  98,  90,  71,  49, 123, 122, 122, 121, 120, 119, 118, 117, 115, 112, 108, 102,  91,  69,  43, 125, 125, 125, 124, 124, 123, 123, 122, 121, 119, 117, 112,  86,  30, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0,   0, 131, 131, 131, 133, 137, 141, 158, 192, 227, 132, 132, 133, 133, 134, 134, 135, 137, 138, 141, 146, 154, 174, 206, 227, 246,  10,  28,  38,  45,  73,  83,  90,  97, 102, 106, 109, 111, 113, 115, 116, 117, 118, 119, 122, 124, 127, 129 }, \
+    { 121, 120, 120, 119, 118, 117, 116, 115, 113, 111, 108, 104,  98,  84,  64, 123, 123, 122, 122, 121, 120, 119, 118, 117, 115, 112, 108, 102,  88,  64, 125, 125, 125, 125, 124, 124, 123, 123, 122, 121, 119, 117, 106,  64, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,   0, 130, 131, 131, 132, 135, 138, 145, 157, 192, 131, 132, 132, 133, 133, 134, 134, 135, 137, 139, 142, 146, 156, 178, 207, 232,  24,  46,  52,  57,  84,  91,  97, 102, 106, 109, 111, 113, 115, 116, 117, 118, 118, 120, 122, 124, 127, 129 }, \
+    {  65,  53,  44,  36,  30,  25,  22,  19,  17,  15,  14,  13,  12,  10,  10,  62,  45,  34,  27,  22,  19,  16,  14,  13,  11,  10,   9,   9,   8,   7,  58,  34,  24,  19,  15,  13,  11,   9,   8,   8,   7,   6,   6,   5,  42,  16,  11,   8,   7,   6,   5,   4,   4,   3,   3,   3,   3,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0, 154, 221, 243, 249, 251, 252, 253, 253, 254, 254, 254, 254, 254, 255, 255,   1,   3,   6,   8,  10,  12,  13,  14,  15,  17,  19,  21,  23,  26,  31,  36,  43,  51,  70,  72,  76,  83, 104 }, \
+    {  79,  68,  57,  47,  38,  32,  27,  23,  20,  18,  16,  14,  13,  12,  10,  81,  63,  48,  37,  29,  23,  20,  17,  15,  13,  12,  11,  10,   9,   8,  85,  56,  38,  26,  20,  16,  13,  11,  10,   9,   8,   7,   6,   5,  94,  32,  18,  12,   9,   7,   6,   5,   4,   4,   4,   3,   3,   3, 128,   0,   0,   0,   0,   0,   0,   0,   0, 137, 150, 213, 242, 248, 251, 252, 253, 253, 254, 254, 254, 254, 254, 255,   1,   4,   6,   9,  11,  14,  15,  16,  17,  19,  21,  24,  28,  32,  38,  45,  54,  63,  82,  87,  93, 104, 119 }, \
+    {  90,  81,  71,  60,  49,  40,  33,  28,  24,  21,  18,  16,  15,  13,  11,  94,  81,  66,  51,  39,  30,  24,  20,  17,  15,  13,  12,  11,  10,   9, 100,  82,  61,  41,  29,  21,  17,  14,  12,  10,   9,   8,   7,   6, 112,  80,  38,  20,  13,  10,   8,   6,   5,   5,   4,   4,   3,   3, 128, 128,   0,   0,   0,   0,   0,   0,   0, 134, 138, 148, 208, 242, 248, 250, 252, 253, 253, 254, 254, 254, 254, 255,   1,   4,   7,  10,  12,  15,  16,  18,  20,  22,  25,  28,  33,  39,  47,  56,  65,  75,  91,  96, 103, 112, 122 }, \
+    { 107, 104, 100,  95,  88,  79,  68,  57,  47,  38,  32,  27,  23,  19,  16, 111, 108, 104,  98,  89,  77,  62,  47,  37,  29,  23,  20,  17,  14,  12, 116, 113, 109, 103,  94,  78,  56,  38,  26,  20,  16,  13,  10,   8, 122, 120, 117, 112, 102,  71,  32,  18,  12,   9,   7,   6,   5,   4, 128, 128, 128,   0,   0,   0,   0,   0,   0, 131, 132, 132, 134, 137, 144, 186, 239, 247, 250, 252, 252, 253, 253, 254,   2,   6,  10,  13,  17,  22,  25,  28,  32,  38,  45,  53,  63,  72,  81,  89,  95, 100, 107, 111, 115, 120, 125 }, \
+    { 114, 113, 111, 109, 107, 103,  99,  93,  86,  77,  66,  54,  44,  33,  26, 117, 116, 114, 112, 110, 107, 102,  95,  87,  74,  59,  45,  34,  26,  21, 121, 119, 118, 117, 115, 112, 108, 102,  90,  72,  51,  35,  21,  15, 124, 124, 123, 122, 121, 119, 116, 110,  96,  57,  27,  14,   9,   7, 128, 128, 128, 128,   0,   0,   0,   0,   0, 130, 130, 130, 131, 131, 132, 133, 136, 142, 171, 234, 246, 250, 251, 253,   3,   9,  16,  21,  26,  38,  44,  51,  60,  70,  80,  87,  93,  98, 102, 105, 108, 110, 113, 116, 120, 123, 126 }, \
+    { 116, 115, 113, 112, 110, 107, 104, 100,  95,  88,  79,  68,  57,  42,  32, 118, 117, 116, 115, 113, 111, 107, 103,  98,  89,  77,  62,  47,  34,  26, 121, 120, 120, 118, 117, 115, 113, 109, 103,  93,  78,  56,  30,  19, 125, 124, 124, 123, 122, 121, 120, 117, 112, 101,  71,  25,  13,  10, 128, 128, 128, 128, 128,   0,   0,   0,   0, 129, 130, 130, 130, 131, 131, 132, 133, 136, 141, 167, 233, 246, 249, 252,   4,  12,  20,  26,  31,  47,  54,  63,  72,  81,  89,  95,  99, 103, 106, 108, 110, 112, 115, 118, 120, 124, 127 }, \
+    { 117, 116, 115, 114, 113, 111, 109, 106, 103,  99,  93,  85,  75,  58,  43, 120, 119, 118, 117, 116, 114, 112, 110, 106, 102,  95,  85,  72,  53,  38, 122, 122, 121, 120, 119, 118, 117, 115, 112, 107, 101,  89,  56,  30, 125, 125, 124, 124, 123, 123, 122, 121, 119, 116, 110,  83,  30,  17, 128, 128, 128, 128, 128, 128,   0,   0,   0, 129, 130, 130, 130, 130, 131, 131, 132, 133, 134, 138, 150, 213, 242, 249,   7,  19,  29,  36,  41,  62,  70,  78,  86,  93,  98, 102, 105, 108, 110, 111, 113, 114, 116, 119, 121, 124, 127 }, \
+    { 118, 117, 116, 115, 114, 113, 111, 109, 106, 103,  98,  92,  85,  69,  53, 120, 119, 119, 118, 117, 116, 114, 112, 110, 106, 101,  94,  84,  67,  49, 123, 122, 121, 121, 120, 119, 118, 116, 114, 111, 107, 100,  77,  43, 125, 125, 125, 124, 124, 123, 123, 122, 121, 119, 116, 105,  64,  29, 128, 128, 128, 128, 128, 128, 128,   0,   0, 129, 130, 130, 130, 130, 130, 131, 131, 132, 133, 135, 139, 155, 224, 245,  10,  27,  38,  44,  49,  71,  79,  86,  93,  98, 102, 105, 107, 110, 111, 113, 114, 115, 117, 119, 122, 124, 127 }, \
+    { 119, 118, 117, 116, 115, 114, 113, 111, 109, 106, 103,  98,  92,  80,  64, 121, 120, 119, 119, 118, 117, 116, 114, 112, 110, 106, 101,  94,  82,  64, 123, 122, 122, 121, 121, 120, 119, 118, 116, 114, 112, 107,  93,  64, 126, 125, 125, 125, 124, 124, 123, 123, 122, 121, 119, 114,  99,  64, 128, 128, 128, 128, 128, 128, 128, 128,   0, 129, 129, 130, 130, 130, 130, 130, 131, 131, 132, 133, 135, 140, 160, 227,  24,  45,  52,  56,  59,  80,  87,  93,  98, 102, 105, 107, 110, 111, 113, 114, 115, 116, 118, 120, 122, 125, 127 }, \
+}
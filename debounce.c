@@ -0,0 +1,113 @@
+/*
+Per-key asymmetric debounce
+  Press:   reported on the first edge, then further edges of that key are ignored for DEBOUNCE ms
+  Release: reported once the key has read released for DEBOUNCE ms without interruption
+
+Each key has a 4-bit timer packed two to a byte: bit 3 selects the phase (press lockout or pending
+release) and bits 0-2 hold the remaining ms. Only keys that differ from the debounced state or have a
+timer running are looked at, so a quiet matrix costs one compare per row.
+*/
+
+#include <string.h>
+#include "debounce.h"
+#include "matrix.h"
+#include "timer.h"
+#include "quantum.h"
+
+#ifndef DEBOUNCE
+#define DEBOUNCE 5
+#endif
+
+_Static_assert(DEBOUNCE <= 7, "Per-key debounce timers hold at most 7 ms");
+
+#define KEY_COUNT               (MATRIX_ROWS * MATRIX_COLS)
+#define TIMER_RELEASE           0x08
+#define TIMER_MS                0x07
+
+static uint8_t timers[(KEY_COUNT + 1) / 2];
+static matrix_row_t running[MATRIX_ROWS];
+static uint16_t last_time;
+
+static uint8_t timer_get(uint8_t key) {
+    return (timers[key / 2] >> ((key & 1) * 4)) & 0x0F;
+}
+
+static void timer_set(uint8_t key, uint8_t value) {
+    uint8_t shift = (key & 1) * 4;
+
+    timers[key / 2] = (timers[key / 2] & ~(0x0F << shift)) | (value << shift);
+}
+
+void debounce_init(uint8_t num_rows) {
+    memset(timers, 0, sizeof(timers));
+    memset(running, 0, sizeof(running));
+    last_time = timer_read();
+}
+
+void debounce_free(void) {}
+
+bool debounce_active(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (running[row]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    uint16_t now = timer_read();
+    uint16_t elapsed = TIMER_DIFF_16(now, last_time);
+
+    last_time = now;
+    if (elapsed > TIMER_MS) {
+        elapsed = TIMER_MS;
+    }
+
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t pending = (raw[row] ^ cooked[row]) | running[row];
+
+        for (; pending; pending &= pending - 1) {
+            uint8_t col = __builtin_ctz(pending);
+            uint8_t key = row * MATRIX_COLS + col;
+            matrix_row_t bit = (matrix_row_t)1 << col;
+            bool differs = (raw[row] ^ cooked[row]) & bit;
+
+            if (running[row] & bit) {
+                uint8_t timer = timer_get(key);
+                uint8_t remaining = (timer & TIMER_MS) > elapsed ? (timer & TIMER_MS) - elapsed : 0;
+
+                if (timer & TIMER_RELEASE) {
+                    if (!differs) {
+                        //Bounced back to pressed, the release was chatter
+                        running[row] &= ~bit;
+                    } else if (!remaining) {
+                        cooked[row] &= ~bit;
+                        running[row] &= ~bit;
+                    } else {
+                        timer_set(key, TIMER_RELEASE | remaining);
+                    }
+                    continue;
+                }
+
+                //Still inside the window after a press, edges here are bounce
+                if (remaining) {
+                    timer_set(key, remaining);
+                    continue;
+                }
+                running[row] &= ~bit;
+            }
+
+            if (!differs) {
+                continue;
+            }
+            if (raw[row] & bit) {
+                cooked[row] |= bit;
+                timer_set(key, DEBOUNCE);
+            } else {
+                timer_set(key, TIMER_RELEASE | DEBOUNCE);
+            }
+            running[row] |= bit;
+        }
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+#include "samd51j18a.h"
+
+/* Cortex-M4 DWT cycle counter, used for on-device timing measurements */
+
+//Core clock driving CYCCNT (see clks.h)
+#ifndef DWT_CPU_HZ
+#define DWT_CPU_HZ 120000000UL
+#endif
+
+#define DWT_CYCLES_PER_US (DWT_CPU_HZ / 1000000UL)
+
+static inline void dwt_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t dwt_cycles(void) {
+    return DWT->CYCCNT;
+}
@@ -0,0 +1,103 @@
+#include "frame_budget.h"
+
+#include "quantum.h"
+#ifdef LED_BENCH
+#include "md_rgb_matrix.h"
+#include "dwt.h"
+#endif
+
+//Read by rgb_matrix as RGB_MATRIX_LED_FLUSH_LIMIT, see config.h
+unsigned char led_frame_interval = FRAME_BUDGET_INTERVAL_MIN;
+
+frame_budget_stats_t frame_budget_stats = { .interval = FRAME_BUDGET_INTERVAL_MIN };
+
+//Interval the scan rate calls for, and the one the LED frames themselves allow
+static uint8_t budget_interval = FRAME_BUDGET_INTERVAL_MIN;
+static uint8_t idle_interval;
+static uint8_t power_interval;
+
+static uint32_t window_timer;
+static uint32_t window_loops;
+static uint32_t window_frames;
+
+static void apply_interval(void) {
+    led_frame_interval = budget_interval > idle_interval ? budget_interval : idle_interval;
+    if (power_interval > led_frame_interval) {
+        led_frame_interval = power_interval;
+    }
+    frame_budget_stats.interval = led_frame_interval;
+}
+
+void frame_budget_frame(void) {
+    window_frames++;
+}
+
+void frame_budget_idle(uint8_t interval) {
+    idle_interval = interval;
+    apply_interval();
+}
+
+void frame_budget_power(uint8_t interval) {
+    power_interval = interval;
+    apply_interval();
+}
+
+void frame_budget_task(void) {
+    uint32_t elapsed;
+
+    window_loops++;
+    elapsed = timer_elapsed32(window_timer);
+    if (elapsed < FRAME_BUDGET_WINDOW) {
+        return;
+    }
+
+    frame_budget_stats.scan_hz = window_loops * 1000 / elapsed;
+    frame_budget_stats.frame_hz = window_frames * 1000 / elapsed;
+
+    //Back off quickly when the scan rate suffers, recover one step at a time with some headroom
+    if (frame_budget_stats.scan_hz < FRAME_BUDGET_SCAN_HZ) {
+        budget_interval = budget_interval * 2 > FRAME_BUDGET_INTERVAL_MAX ? FRAME_BUDGET_INTERVAL_MAX : budget_interval * 2;
+    } else if (frame_budget_stats.scan_hz > FRAME_BUDGET_SCAN_HZ + FRAME_BUDGET_SCAN_HZ / 4 && budget_interval > FRAME_BUDGET_INTERVAL_MIN) {
+        budget_interval--;
+    }
+    apply_interval();
+
+    window_timer = timer_read32();
+    window_loops = 0;
+    window_frames = 0;
+}
+
+#ifdef LED_BENCH
+void frame_budget_bench(void) {
+#ifdef CONSOLE_ENABLE
+    uint8_t saved_id = led_animation_id;
+    uint8_t saved_mode = led_lighting_mode;
+    uint32_t loop_cycles = DWT_CPU_HZ / FRAME_BUDGET_SCAN_HZ;
+
+    //The renderer handles RGB_MATRIX_LED_PROCESS_LIMIT LEDs per main loop iteration, so that share has to fit a loop
+    uprintf("LED frame cost (id mode, cycles per frame and per %u LEDs, %% of a %lu cycle loop):\n",
+        RGB_MATRIX_LED_PROCESS_LIMIT, loop_cycles);
+    for (uint8_t id = 0; id < led_setups_count; id++) {
+        for (uint8_t mode = 0; mode < LED_MODE_MAX_INDEX; mode++) {
+            uint32_t start, cycles, chunk;
+
+            led_animation_id = id;
+            led_lighting_mode = mode;
+            start = dwt_cycles();
+            for (uint8_t frame = 0; frame < LED_BENCH_FRAMES; frame++) {
+                for (uint8_t led = 0; led < DRIVER_LED_TOTAL; led++) {
+                    rgb_matrix_driver.set_color(led, 0, 0, 0);
+                }
+            }
+            cycles = (dwt_cycles() - start) / LED_BENCH_FRAMES;
+            chunk = cycles * RGB_MATRIX_LED_PROCESS_LIMIT / DRIVER_LED_TOTAL;
+
+            uprintf("  %2u %u %7lu %6lu %3lu%%%s\n", id, mode, cycles, chunk, chunk * 100 / loop_cycles,
+                chunk > loop_cycles ? " over budget" : "");
+        }
+    }
+    led_animation_id = saved_id;
+    led_lighting_mode = saved_mode;
+#endif
+}
+#endif
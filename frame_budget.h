@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+
+//Keeps the main loop (and with it the matrix scan) at FRAME_BUDGET_SCAN_HZ by stretching the LED frame interval
+//LED frames are dropped first, the scan is never slowed down to make room for them
+#ifndef FRAME_BUDGET_SCAN_HZ
+#define FRAME_BUDGET_SCAN_HZ        1000        //Lowest acceptable main loop rate
+#endif
+#ifndef FRAME_BUDGET_WINDOW
+#define FRAME_BUDGET_WINDOW         100         //Measurement window (ms)
+#endif
+#define FRAME_BUDGET_INTERVAL_MIN   10          //Fastest LED frame interval (ms), the previous fixed RGB_MATRIX_LED_FLUSH_LIMIT
+#define FRAME_BUDGET_INTERVAL_MAX   50          //Slowest LED frame interval (ms)
+
+typedef struct {
+    uint32_t scan_hz;       //Main loop iterations per second over the last window, probe-only loops run well past 64 kHz
+    uint32_t frame_hz;      //LED frames rendered per second over the last window
+    uint8_t interval;       //Current LED frame interval (ms)
+} frame_budget_stats_t;
+
+extern frame_budget_stats_t frame_budget_stats;
+
+//Once per main loop iteration
+void frame_budget_task(void);
+//Once per rendered LED frame
+void frame_budget_frame(void);
+//Lowest frame interval (ms) to use regardless of the scan rate, 0 for none (see led_flush.c)
+void frame_budget_idle(uint8_t interval);
+//Same for the power tier the keyboard is in, 0 for none (see idle_power.c)
+void frame_budget_power(uint8_t interval);
+
+#ifdef LED_BENCH
+#ifndef LED_BENCH_FRAMES
+#define LED_BENCH_FRAMES            20          //Frames rendered per pattern and lighting mode
+#endif
+//Renders every pattern in every lighting mode without flushing and prints the cycles per frame against the loop budget
+void frame_budget_bench(void);
+#endif
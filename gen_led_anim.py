@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Generate led_anim_gen.h, the curves led_anim.c reads from flash.
+
+Each curve covers one cycle of a 32-bit phase in LUT_SIZE steps, with the
+first entry repeated at the end so led_anim.c can interpolate across the
+wrap. Breathing reproduces md_rgb_matrix.c's curve: led_animation_breathe_cur
+runs 0 - 255 - 0 one step per frame and the brightness is
+0.000015 * cur * cur, clipped to 1. The sine is in Q15.
+
+The breathing table is checked against that per-frame curve at its original
+10 ms frame interval, interpolated the way led_anim.c does it. The raised
+cosine LED_ANIM_BREATHE_SINE builds from the sine table is checked against
+0.5 - 0.5 * cos over the same breath. The worst difference of each in 8-bit
+channel units is printed.
+
+Run from the keyboard directory (build.sh does this before compiling):
+    ./gen_led_anim.py
+"""
+
+import math
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OUTPUT = os.path.join(HERE, "led_anim_gen.h")
+
+LUT_SIZE = 256
+# Matching PIXEL_LEVEL_MAX in pixel.h
+LEVEL_MAX = 256
+# Matching config_led.h and the frame interval breathing was tuned at
+BREATHE_MAX_STEP = 255
+BREATHE_FRAME_MS = 10
+BREATHE_FRAMES = 2 * BREATHE_MAX_STEP
+# Worst acceptable difference from the per-frame curve, in channel units
+BREATHE_TOLERANCE = 1
+
+
+def breathe_mult(cur):
+    return min(1.0, 0.000015 * cur * cur)
+
+
+def breathe_level(phase):
+    """Level (0 - LEVEL_MAX) at a phase of 0 - 1, cur rising over the first half and falling over the second."""
+    cur = phase * BREATHE_FRAMES
+    if cur > BREATHE_MAX_STEP:
+        cur = BREATHE_FRAMES - cur
+    return breathe_mult(cur) * LEVEL_MAX
+
+
+def lookup(table, phase):
+    """Same fixed point interpolation as curve() in led_anim.c."""
+    index = phase >> 24
+    frac = (phase >> 16) & 0xFF
+    a, b = table[index], table[index + 1]
+    return a + (((b - a) * frac) >> 8)
+
+
+def check_breathe(table):
+    worst = 0
+    for frame in range(BREATHE_FRAMES):
+        # The core stepped cur before drawing, so frame n shows cur n + 1
+        cur = frame + 1 if frame < BREATHE_MAX_STEP else BREATHE_FRAMES - frame - 1
+        position = cur if frame < BREATHE_MAX_STEP else BREATHE_FRAMES - cur
+        phase = (position * (1 << 32) // BREATHE_FRAMES) & 0xFFFFFFFF
+        for channel in (255, 128, 32):
+            expected = int(channel * breathe_mult(cur))
+            actual = (channel * lookup(table, phase)) >> 8
+            worst = max(worst, abs(expected - actual))
+    return worst
+
+
+def sine_breathe_level(sine, phase):
+    """Same as led_anim_breathe() with LED_ANIM_BREATHE_SINE."""
+    cosine = lookup(sine, (phase + 0x40000000) & 0xFFFFFFFF)
+    return (LEVEL_MAX - ((cosine * LEVEL_MAX) >> 15)) // 2
+
+
+def check_sine_breathe(sine):
+    worst = 0
+    for frame in range(BREATHE_FRAMES):
+        phase = (frame * (1 << 32) // BREATHE_FRAMES) & 0xFFFFFFFF
+        mult = 0.5 - 0.5 * math.cos(2 * math.pi * frame / BREATHE_FRAMES)
+        level = sine_breathe_level(sine, phase)
+        for channel in (255, 128, 32):
+            expected = int(channel * mult)
+            actual = (channel * level) >> 8
+            worst = max(worst, abs(expected - actual))
+    return worst
+
+
+def generate():
+    breathe = [int(round(breathe_level(i / LUT_SIZE))) for i in range(LUT_SIZE)]
+    sine = [int(round(math.sin(2 * math.pi * i / LUT_SIZE) * 32767)) for i in range(LUT_SIZE)]
+    breathe.append(breathe[0])
+    sine.append(sine[0])
+
+    worst = check_breathe(breathe)
+    if worst > BREATHE_TOLERANCE:
+        sys.exit("Breathing table is {} off the per-frame curve".format(worst))
+    worst_sine = check_sine_breathe(sine)
+    if worst_sine > BREATHE_TOLERANCE:
+        sys.exit("Sine breathing is {} off the raised cosine".format(worst_sine))
+
+    def table(values, per_line=16):
+        lines = []
+        for start in range(0, len(values), per_line):
+            lines.append("    " + ", ".join("{:6}".format(v) for v in values[start:start + per_line]) + ",")
+        return " \\\n".join(lines)
+
+    def define(name, comment, body):
+        return "//{}\n#define {} {{ \\\n{} \\\n}}\n".format(comment, name, body)
+
+    out = [
+        "// Generated by gen_led_anim.py, do not edit",
+        "",
+        "#pragma once",
+        "",
+        "#define LED_ANIM_LUT_SIZE {}".format(LUT_SIZE),
+        "",
+        define("LED_ANIM_BREATHE", "Breathing level (0-{}) over one breath".format(LEVEL_MAX), table(breathe)),
+        define("LED_ANIM_SINE", "Sine over one turn, Q15", table(sine)),
+    ]
+    return "\n".join(out), worst, worst_sine
+
+
+def main():
+    text, worst, worst_sine = generate()
+    with open(OUTPUT, "w") as f:
+        f.write(text)
+    print("led_anim_gen.h: breathing within {} of the per-frame curve, sine breathing within {} of the raised cosine"
+          .format(worst, worst_sine))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""Generate config_led_gen.h from ISSI3733_LED_MAP in config_led.h.
+
+Produces the g_led_config matrix, point and flag tables along with derived
+per-LED tables (polar angle/radius around the layout centre and row/column
+bands) so effects can look them up instead of computing them every frame.
+Keypress-reactive effects get distance and angle tables from every key LED
+to every LED for the same reason. The flush gets each LED's driver and PWM
+register addresses so it can write changed registers only.
+
+Run from the keyboard directory (build.sh does this before compiling):
+    ./gen_led_config.py
+"""
+
+import math
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "config_led.h")
+OUTPUT = os.path.join(HERE, "config_led_gen.h")
+
+MATRIX_ROWS = 5
+MATRIX_COLS = 15
+NO_LED = "NO_LED"
+NO_SCAN = 255
+
+# Physical coordinates are scaled into the RGB matrix space of (0-224, 0-64)
+POINT_MAX_X = 224
+POINT_MAX_Y = 64
+CENTER_X = POINT_MAX_X // 2
+CENTER_Y = POINT_MAX_Y // 2
+
+# Matching LED_FLAG_* in rgb_matrix_types.h
+LED_FLAG_MODIFIER = 0x01
+LED_FLAG_UNDERGLOW = 0x02
+LED_FLAG_KEYLIGHT = 0x04
+LED_FLAG_INDICATOR = 0x08
+
+# IS31FL3733 PWM registers are numbered (SW - 1) * 16 + (CS - 1)
+PWM_CS = 16
+
+LED_RE = re.compile(
+    r"\.id = (\d+), \.x = ([-\d.]+), \.y = ([-\d.]+), "
+    r"\.adr = \{ \.drv = (\d+), \.cs = (\d+), \.swr = (\d+), \.swg = (\d+), \.swb = (\d+) \}, \.scan = (\d+)"
+)
+
+
+def parse(text):
+    leds = []
+    for m in LED_RE.finditer(text):
+        drv, cs, swr, swg, swb = (int(v) for v in m.group(4, 5, 6, 7, 8))
+        pwm = [(sw - 1) * PWM_CS + cs - 1 for sw in (swr, swg, swb)]
+        leds.append({"id": int(m[1]), "x": float(m[2]), "y": float(m[3]), "drv": drv - 1, "pwm": pwm, "scan": int(m[9])})
+    if [led["id"] for led in leds] != list(range(1, len(leds) + 1)):
+        sys.exit("ISSI3733_LED_MAP ids must run 1..N in order")
+
+    m = re.search(r"#define LED_MODIFIER_SCANCODES \{([^}]*)\}", text)
+    if not m:
+        sys.exit("LED_MODIFIER_SCANCODES not found in config_led.h")
+    modifiers = {int(v) for v in m[1].split(",") if v.strip()}
+
+    indicators = {int(v) for v in re.findall(r"#define USB_LED_\w+_SCANCODE\s+(\d+)", text)}
+    indicators.discard(NO_SCAN)
+
+    return leds, modifiers, indicators
+
+
+def generate(leds, modifiers, indicators):
+    min_x = min(led["x"] for led in leds)
+    max_x = max(led["x"] for led in leds)
+    min_y = min(led["y"] for led in leds)
+    max_y = max(led["y"] for led in leds)
+
+    matrix = [[NO_LED] * MATRIX_COLS for _ in range(MATRIX_ROWS)]
+    points, flags, angles, radii, rows, cols = [], [], [], [], [], []
+
+    for index, led in enumerate(leds):
+        x = int((led["x"] - min_x) / (max_x - min_x) * POINT_MAX_X)
+        y = int((led["y"] - min_y) / (max_y - min_y) * POINT_MAX_Y)
+        points.append((x, y))
+
+        if led["scan"] == NO_SCAN:
+            flags.append(LED_FLAG_UNDERGLOW)
+        else:
+            row, col = divmod(led["scan"], MATRIX_COLS)
+            matrix[row][col] = str(index)
+            flag = LED_FLAG_MODIFIER if led["scan"] in modifiers else LED_FLAG_KEYLIGHT
+            if led["scan"] in indicators:
+                flag |= LED_FLAG_INDICATOR
+            flags.append(flag)
+
+        # Same conventions as the stock effects: angle of 0-255 per full turn, radius in point units
+        dx, dy = x - CENTER_X, y - CENTER_Y
+        angles.append(int(round(math.atan2(dy, dx) / (2 * math.pi) * 256)) & 0xFF)
+        radii.append(min(255, int(round(math.hypot(dx, dy)))))
+        rows.append(min(MATRIX_ROWS - 1, y * MATRIX_ROWS // POINT_MAX_Y))
+        cols.append(min(MATRIX_COLS - 1, x * MATRIX_COLS // POINT_MAX_X))
+
+    # Key LEDs come first, so a hit's LED index is its row in the hit tables
+    keys = sum(1 for led in leds if led["scan"] != NO_SCAN)
+    if any(led["scan"] == NO_SCAN for led in leds[:keys]):
+        sys.exit("ISSI3733_LED_MAP must list every key LED before the underglow")
+
+    # Same rounding as the stock effects: sqrt16 truncates, atan2_8 gives 256 per full turn
+    hit_distance, hit_angle = [], []
+    for hx, hy in points[:keys]:
+        hit_distance.append([min(255, math.isqrt((x - hx) ** 2 + (y - hy) ** 2)) for x, y in points])
+        hit_angle.append([int(round(math.atan2(y - hy, x - hx) / (2 * math.pi) * 256)) & 0xFF for x, y in points])
+
+    def table(values, per_line=MATRIX_COLS):
+        lines = []
+        for start in range(0, len(values), per_line):
+            lines.append("    " + ", ".join(values[start:start + per_line]) + ",")
+        return " \\\n".join(lines)
+
+    def define(name, comment, body):
+        return "//{}\n#define {} {{ \\\n{} \\\n}}\n".format(comment, name, body)
+
+    matrix_body = " \\\n".join(
+        "    {{ {} }},".format(", ".join("{:>6}".format(v) for v in row)) for row in matrix
+    )
+    points_body = table(["{{ {:3}, {:3} }}".format(x, y) for x, y in points])
+    number = lambda values: ["{:3}".format(v) for v in values]
+    registers = ["{{ {}, {:3}, {:3}, {:3} }}".format(led["drv"], *led["pwm"]) for led in leds]
+    rows_of = lambda rows: " \\\n".join("    {{ {} }},".format(", ".join(number(row))) for row in rows)
+
+    out = [
+        "// Generated by gen_led_config.py from ISSI3733_LED_MAP in config_led.h, do not edit",
+        "",
+        "#pragma once",
+        "",
+        "#define LED_CENTER_X {}".format(CENTER_X),
+        "#define LED_CENTER_Y {}".format(CENTER_Y),
+        "#define LED_KEY_COUNT {}".format(keys),
+        "",
+        define("LED_CONFIG_MATRIX", "Key matrix position to LED index", matrix_body),
+        define("LED_CONFIG_POINTS", "LED positions scaled to (0-{}, 0-{})".format(POINT_MAX_X, POINT_MAX_Y), points_body),
+        define("LED_CONFIG_FLAGS", "LED_FLAG_* per LED", table(number(flags))),
+        define("LED_POLAR_ANGLE", "Angle around the centre, 256 per full turn", table(number(angles))),
+        define("LED_POLAR_RADIUS", "Distance from the centre in point units", table(number(radii))),
+        define("LED_ROW_BAND", "Horizontal band (0-{}) the LED falls into".format(MATRIX_ROWS - 1), table(number(rows))),
+        define("LED_COL_BAND", "Vertical band (0-{}) the LED falls into".format(MATRIX_COLS - 1), table(number(cols))),
+        define("LED_PWM_REGISTERS", "Driver index and red, green, blue PWM registers per LED", table(registers, 8)),
+        define("LED_HIT_DISTANCE", "Distance in point units from each key LED to every LED", rows_of(hit_distance)),
+        define("LED_HIT_ANGLE", "Angle from each key LED to every LED, 256 per full turn", rows_of(hit_angle)),
+    ]
+    return "\n".join(out)
+
+
+def main():
+    with open(SOURCE) as f:
+        leds, modifiers, indicators = parse(f.read())
+    with open(OUTPUT, "w") as f:
+        f.write(generate(leds, modifiers, indicators))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,70 @@
+#include "idle_power.h"
+
+#include <string.h>
+#include "quantum.h"
+#include "frame_budget.h"
+
+idle_power_stats_t idle_power_stats;
+
+static const uint16_t tier_scan_ms[IDLE_POWER_TIERS] = { 0, IDLE_POWER_IDLE_SCAN_MS, IDLE_POWER_DEEP_SCAN_MS };
+static const uint8_t tier_frame_ms[IDLE_POWER_TIERS] = { 0, IDLE_POWER_IDLE_FRAME_MS, IDLE_POWER_DEEP_FRAME_MS };
+
+static idle_power_tier_t tier;
+static uint32_t tier_timer;
+static uint32_t activity_timer;
+static uint32_t scan_timer;
+
+static void set_tier(idle_power_tier_t next) {
+    idle_power_stats.tier_ms[tier] += timer_elapsed32(tier_timer);
+    tier_timer = timer_read32();
+    tier = next;
+    frame_budget_power(tier_frame_ms[tier]);
+}
+
+bool idle_power_scan_due(void) {
+    if (tier == IDLE_POWER_ACTIVE || timer_elapsed32(scan_timer) >= tier_scan_ms[tier]) {
+        scan_timer = timer_read32();
+        return true;
+    }
+    return false;
+}
+
+void idle_power_probed(bool changed) {
+    idle_power_stats.probes++;
+    if (changed) {
+        idle_power_activity();
+    }
+}
+
+void idle_power_activity(void) {
+    activity_timer = timer_read32();
+    if (tier != IDLE_POWER_ACTIVE) {
+        idle_power_stats.wakes++;
+        set_tier(IDLE_POWER_ACTIVE);
+    }
+}
+
+void idle_power_task(void) {
+    uint32_t idle = timer_elapsed32(activity_timer);
+
+    if (tier < IDLE_POWER_DEEP && idle >= IDLE_POWER_DEEP_MS) {
+        set_tier(IDLE_POWER_DEEP);
+    } else if (tier < IDLE_POWER_IDLE && idle >= IDLE_POWER_IDLE_MS) {
+        set_tier(IDLE_POWER_IDLE);
+    }
+}
+
+void idle_power_print(void) {
+#ifdef CONSOLE_ENABLE
+    static const char *const names[IDLE_POWER_TIERS] = { "active", "idle", "deep" };
+
+    //Book the time so far to the current tier
+    set_tier(tier);
+    uprintf("Power tiers (now %s):\n", names[tier]);
+    for (uint8_t i = 0; i < IDLE_POWER_TIERS; i++) {
+        uprintf("  %-6s %lu ms\n", names[i], idle_power_stats.tier_ms[i]);
+    }
+    uprintf("  wakes %lu probes %lu\n", idle_power_stats.wakes, idle_power_stats.probes);
+#endif
+    memset(&idle_power_stats, 0, sizeof(idle_power_stats));
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//Steps the matrix scan and LED frame rates down after a while without key changes
+//Between the slow scans, while no key is down, every row is selected at once and the columns read in one go,
+//so a new press is seen by the next loop iteration and brings back the full rate for the scan that follows.
+//While any key is down matrix.c scans in full on every loop, the combined reading would hide a second key.
+#ifndef IDLE_POWER_IDLE_MS
+#define IDLE_POWER_IDLE_MS          30000       //No key changes for this long enters the idle tier
+#endif
+#ifndef IDLE_POWER_DEEP_MS
+#define IDLE_POWER_DEEP_MS          300000      //And for this long the deep tier
+#endif
+#ifndef IDLE_POWER_IDLE_SCAN_MS
+#define IDLE_POWER_IDLE_SCAN_MS     4           //Full scan interval in the idle tier
+#endif
+#ifndef IDLE_POWER_DEEP_SCAN_MS
+#define IDLE_POWER_DEEP_SCAN_MS     10          //Full scan interval in the deep tier
+#endif
+#ifndef IDLE_POWER_IDLE_FRAME_MS
+#define IDLE_POWER_IDLE_FRAME_MS    50          //LED frame interval in the idle tier
+#endif
+#ifndef IDLE_POWER_DEEP_FRAME_MS
+#define IDLE_POWER_DEEP_FRAME_MS    200         //LED frame interval in the deep tier
+#endif
+
+typedef enum {
+    IDLE_POWER_ACTIVE,
+    IDLE_POWER_IDLE,
+    IDLE_POWER_DEEP,
+    IDLE_POWER_TIERS
+} idle_power_tier_t;
+
+typedef struct {
+    uint32_t tier_ms[IDLE_POWER_TIERS]; //Time spent in each tier
+    uint32_t wakes;                     //Returns to the active tier
+    uint32_t probes;                    //Loop iterations that only probed the columns
+} idle_power_stats_t;
+
+extern idle_power_stats_t idle_power_stats;
+
+//From matrix_scan_custom while no key is down, true when this loop iteration is due a full scan regardless of the probe
+bool idle_power_scan_due(void);
+//From matrix_scan_custom when the probe saw the column state change without a full scan
+void idle_power_probed(bool changed);
+//A key changed, back to the active tier
+void idle_power_activity(void);
+//From the housekeeping task, steps down once the thresholds pass
+void idle_power_task(void);
+//Prints the time per tier over the console and clears the counters
+void idle_power_print(void);
@@ -1,8 +1,31 @@
 #include QMK_KEYBOARD_H
+#include "arm_atsam_protocol.h"
 
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
+
+#include "frame_budget.h"
+#include "idle_power.h"
+#include "led_anim.h"
+#include "task_sched.h"
+#include "sr_shadow.h"
+#include "led_flush.h"
+#include "led_indicator.h"
+#include "led_power.h"
+#include "matrix_scan.h"
+#include "settings_log.h"
+#include "unicode_queue.h"
+#ifdef LATENCY_STATS_ENABLE
+#include "latency.h"
+#endif
+#ifdef SOF_SYNC_ENABLE
+#include "sof_sync.h"
+#endif
+#ifdef PIXEL_BENCH
+#include "pixel.h"
+#endif
 
 enum ctrl_keycodes {
     L_BRI = SAFE_RANGE, // LED Brightness Increase
@@ -17,17 +40,24 @@ enum ctrl_keycodes {
     L_OFF,              // LED Off
     L_T_BR,             // LED Toggle Breath Effect
     L_T_PTD,            // LED Toggle Scrolling Pattern Direction
-    U_T_AGCR,           // USB Toggle Automatic GCR control
+    U_T_AGCR,           // USB Toggle predictive LED current limit / reactive automatic GCR control
     DBG_TOG,            // DEBUG Toggle On / Off
     DBG_MTRX,           // DEBUG Toggle Matrix prints
     DBG_KBD,            // DEBUG Toggle Keyboard prints
     DBG_MOU,            // DEBUG Toggle Mouse prints
+    DBG_PRF,            // DEBUG Print performance stats
     MD_BOOT             // Restart into bootloader after hold timeout
 };
        
-typedef union {
-  uint32_t raw;
-  struct {
+// Resolved keycodes for the active layers, defined in keymap.c after the keymaps
+void keycode_cache_record(uint16_t keycode, keyrecord_t *record);
+void keycode_cache_print(void);
+
+// Bump when the layout of kb_config_t changes
+#define KB_CONFIG_VERSION 1
+
+// The first 32 bits match the layout previously stored in eeconfig_kb
+typedef struct {
     uint8_t led_animation_id: 3,
             led_lighting_mode: 2,
             led_animation_breathing: 1,
@@ -36,69 +66,170 @@ typedef union {
     uint8_t gcr_desired;
     uint8_t led_animation_speed;
     uint8_t _unused;
-  };
 } kb_config_t;
 
+_Static_assert(sizeof(kb_config_t) <= SETTINGS_LOG_PAYLOAD_SIZE, "kb_config_t does not fit in a settings log record");
+
 kb_config_t kb_config;
 
-void load_saved_settings(void) {
-    kb_config.raw = eeconfig_read_kb();
+#ifdef PROCESS_RECORD_PROFILE
+#include "dwt.h"
+
+// Cycle cost of every key event passing through process_record_user
+typedef struct {
+    uint32_t events;
+    uint32_t cycles_max;
+    uint64_t cycles_total;
+} record_profile_t;
+
+record_profile_t record_profile;
 
+void record_profile_print(void) {
+#ifdef CONSOLE_ENABLE
+    uint32_t cycles_avg = record_profile.events
+        ? (uint32_t)(record_profile.cycles_total / record_profile.events)
+        : 0;
+
+    uprintf("Key event profile:\n");
+    uprintf("  events %lu\n", record_profile.events);
+    uprintf("  cycles avg %lu max %lu\n", cycles_avg, record_profile.cycles_max);
+    uprintf("  events/sec %lu\n", cycles_avg ? DWT_CPU_HZ / cycles_avg : 0);
+#endif
+    record_profile = (record_profile_t){ 0 };
+}
+#endif
+
+// Idle time after the last settings change before it is committed to flash
+#ifndef SETTINGS_COMMIT_DELAY
+#define SETTINGS_COMMIT_DELAY 3000
+#endif
+
+// Settings changes are applied from RAM immediately and committed lazily
+typedef struct {
+    uint32_t changes;   // sync_settings calls
+    uint32_t commits;   // Settings log writes actually performed
+    uint32_t coalesced; // changes folded into a pending commit
+} settings_stats_t;
+
+settings_stats_t settings_stats;
+
+static bool settings_dirty;
+static uint32_t settings_dirty_timer;
+
+// SDB_N goes through the shift register shadow with the rest of this pass's changes, see sr_shadow.h
+static void led_drivers_set(bool enabled) {
+    Srdata_t mask = { .reg = 0 };
+    Srdata_t bits = { .reg = 0 };
+
+    mask.bit.SDB_N = 1;
+    bits.bit.SDB_N = enabled;
+    sr_shadow_write(mask.reg, bits.reg);
+}
+
+// Pushes every field to the LED state, only needed when the whole config is (re)loaded
+void apply_settings(void) {
     led_animation_id = kb_config.led_animation_id;
     gcr_desired = kb_config.gcr_desired;
     led_lighting_mode = kb_config.led_lighting_mode;
 
-    bool prev_led_animation_breathing = led_animation_breathing;
-    led_animation_breathing = kb_config.led_animation_breathing;
-    if (led_animation_breathing && !prev_led_animation_breathing) {
-        gcr_breathe = gcr_desired;
-        led_animation_breathe_cur = BREATHE_MIN_STEP;
-        breathe_dir = 1;
-    }
+    // Breathing runs on led_anim.c's timer phase, md_rgb_matrix.c's own stays off
+    led_anim_set_breathing(kb_config.led_animation_breathing);
 
     led_animation_direction = kb_config.led_animation_direction;
     led_animation_speed = kb_config.led_animation_speed;
 
-    bool led_enabled = kb_config.led_enabled;
-    I2C3733_Control_Set(led_enabled);
+    led_drivers_set(kb_config.led_enabled);
+}
 
+void save_settings(void) {
+    // Append the keyboard config to the settings log
+    settings_log_write(&kb_config, sizeof(kb_config), KB_CONFIG_VERSION);
+    settings_dirty = false;
+    settings_stats.commits++;
 #ifdef CONSOLE_ENABLE
-    uprintf("Loading saved settings from EEPROM:\n");
-    uprintf("  led_animation_id %d\n", led_animation_id);
-    uprintf("  gcr_desired %d\n", gcr_desired);
-    uprintf("  led_lighting_mode %d\n", led_lighting_mode);
-    uprintf("  led_animation_breathing %d\n", led_animation_breathing);
-    uprintf("  led_animation_direction %d\n", led_animation_direction);
-    uprintf("  led_animation_speed %f\n", led_animation_speed);
-    uprintf("  led_enabled %d\n", led_enabled);
+    LOG_PRINTF("Saving settings to flash\n");
 #endif
 }
 
-void save_settings(void) {
-    // Save the keyboard config to EEPROM
-    eeconfig_update_kb(kb_config.raw);
+// kb_config_t only grows: new fields go at the end, and settings_log_read zero pads a record written before
+// they existed. Each step gives the fields of the version after it the value they start from, then falls
+// through to the next one. A record from a newer build keeps the fields this one knows.
+static void migrate_settings(uint8_t version) {
+    switch (version) {
+    // Version 1 is the first logged layout, nothing to carry forward yet
+    default:
+        break;
+    }
+}
+
+void load_saved_settings(void) {
+    uint8_t version;
+
+    if (!settings_log_read(&kb_config, sizeof(kb_config), &version)) {
+        // Nothing logged yet, or no record passed its CRC: carry the settings over from the old eeconfig_kb slot
+        uint32_t raw = eeconfig_read_kb();
+        memcpy(&kb_config, &raw, sizeof(raw));
+        save_settings();
+    } else if (version != KB_CONFIG_VERSION) {
+        migrate_settings(version);
+        save_settings();
+    }
+    apply_settings();
+
 #ifdef CONSOLE_ENABLE
-    uprintf("Saving settings to EEPROM\n");
+    LOG_PRINTF("Loading saved settings from flash:\n");
+    LOG_PRINTF("  led_animation_id %d\n", led_animation_id);
+    LOG_PRINTF("  gcr_desired %d\n", gcr_desired);
+    LOG_PRINTF("  led_lighting_mode %d\n", led_lighting_mode);
+    LOG_PRINTF("  led_animation_breathing %d\n", led_anim_breathing);
+    LOG_PRINTF("  led_animation_direction %d\n", led_animation_direction);
+    LOG_PRINTF("  led_animation_speed %u\n", kb_config.led_animation_speed);
+    LOG_PRINTF("  led_enabled %d\n", kb_config.led_enabled);
 #endif
 }
 
+// Schedules a commit, the setters below have already applied the change
 void sync_settings(void) {
-    save_settings();
-    load_saved_settings();
+    settings_stats.changes++;
+    if (settings_dirty) {
+        settings_stats.coalesced++;
+    }
+    settings_dirty = true;
+    settings_dirty_timer = timer_read32();
+}
+
+// Commit pending settings now, e.g. before the MCU stops running
+void flush_settings(void) {
+    if (settings_dirty) {
+        save_settings();
+    }
+}
+
+// Called from the main loop, commits once the settings have been left alone
+void settings_task(void) {
+    if (settings_dirty && timer_elapsed32(settings_dirty_timer) >= SETTINGS_COMMIT_DELAY) {
+        save_settings();
+    }
+}
+
+void suspend_power_down_user(void) {
+    flush_settings();
 }
 
 void keyboard_post_init_kb(void) {
 #ifdef CONSOLE_ENABLE
-    uprintf("Running keyboard post-init\n");
+    LOG_PRINTF("Running keyboard post-init\n");
 #endif
     load_saved_settings();
+    // Frames are held to the current budget up front, the 5V feedback loop is only the fallback
+    usb_gcr_auto = !led_power_limit;
 }
 
 void eeconfig_init_kb(void) {
 #ifdef CONSOLE_ENABLE
-    uprintf("Running eeconfig_init_kb\n");
+    LOG_PRINTF("Running eeconfig_init_kb\n");
 #endif
-    kb_config.raw = 0;
+    kb_config = (kb_config_t){ 0 };
     kb_config.led_animation_id = 0;
     kb_config.led_lighting_mode = 0;
     kb_config.led_animation_breathing = false;
@@ -110,60 +241,82 @@ void eeconfig_init_kb(void) {
     save_settings();
 }
 
-void led_pattern_next(void) {
-    kb_config.led_animation_id = (kb_config.led_animation_id + 1) % led_setups_count;
+// Per-field setters, each one only updates the LED state driven by its field
+void set_led_animation_id(uint8_t id) {
+    kb_config.led_animation_id = id;
+    led_animation_id = kb_config.led_animation_id;
     sync_settings();
 }
 
-void led_pattern_prev(void) {
-    kb_config.led_animation_id = (kb_config.led_animation_id - 1) % led_setups_count;
+void set_led_lighting_mode(uint8_t mode) {
+    kb_config.led_lighting_mode = mode;
+    led_lighting_mode = kb_config.led_lighting_mode;
     sync_settings();
 }
 
-void led_mode_next(void) {
-    kb_config.led_lighting_mode = (kb_config.led_lighting_mode + 1) % LED_MODE_MAX_INDEX;
+void set_gcr_desired(uint8_t gcr) {
+    kb_config.gcr_desired = gcr;
+    gcr_desired = kb_config.gcr_desired;
     sync_settings();
 }
 
-void gcr_desired_increase(void) {
-    int brightness = kb_config.gcr_desired + LED_GCR_STEP;
-    kb_config.gcr_desired = brightness > LED_GCR_MAX ? LED_GCR_MAX : brightness;
+void set_led_animation_speed(uint8_t speed) {
+    kb_config.led_animation_speed = speed;
+    led_animation_speed = kb_config.led_animation_speed;
     sync_settings();
 }
 
-void gcr_desired_decrease(void) {
-    int brightness = kb_config.gcr_desired - LED_GCR_STEP;
-    kb_config.gcr_desired = brightness < 0 ? 0 : brightness;
+void led_set_animation_breathing(bool breathing) {
+    kb_config.led_animation_breathing = breathing;
+    led_anim_set_breathing(breathing);
     sync_settings();
 }
 
 void led_set_enabled(bool enabled) {
-    kb_config.led_enabled = enabled;
+    if (kb_config.led_enabled != enabled) {
+        kb_config.led_enabled = enabled;
+        led_drivers_set(enabled);
+    }
     sync_settings();
 }
 
-void led_set_animation_breathing(bool breathing) {
-    kb_config.led_animation_breathing = breathing;
-    sync_settings();
+void led_pattern_next(void) {
+    set_led_animation_id((kb_config.led_animation_id + 1) % led_setups_count);
+}
+
+void led_pattern_prev(void) {
+    set_led_animation_id((kb_config.led_animation_id - 1) % led_setups_count);
+}
+
+void led_mode_next(void) {
+    set_led_lighting_mode((kb_config.led_lighting_mode + 1) % LED_MODE_MAX_INDEX);
+}
+
+void gcr_desired_increase(void) {
+    int brightness = kb_config.gcr_desired + LED_GCR_STEP;
+    set_gcr_desired(brightness > LED_GCR_MAX ? LED_GCR_MAX : brightness);
+}
+
+void gcr_desired_decrease(void) {
+    int brightness = kb_config.gcr_desired - LED_GCR_STEP;
+    set_gcr_desired(brightness < 0 ? 0 : brightness);
 }
 
 void led_animation_speed_increase(void) {
-    kb_config.led_animation_speed += 1;
-    sync_settings();
+    set_led_animation_speed(kb_config.led_animation_speed + 1);
 }
 
 void led_animation_speed_decrease(void) {
-    kb_config.led_animation_speed = kb_config.led_animation_speed < 1
+    set_led_animation_speed(kb_config.led_animation_speed < 1
         ? 0
-        : kb_config.led_animation_speed - 1;
-    sync_settings();
+        : kb_config.led_animation_speed - 1);
 }
 
 #define MODS_SHIFT  (get_mods() & MOD_BIT(KC_LSHIFT) || get_mods() & MOD_BIT(KC_RSHIFT))
 #define MODS_CTRL  (get_mods() & MOD_BIT(KC_LCTL) || get_mods() & MOD_BIT(KC_RCTRL))
 #define MODS_ALT  (get_mods() & MOD_BIT(KC_LALT) || get_mods() & MOD_BIT(KC_RALT))
 
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+static bool process_record_driver(uint16_t keycode, keyrecord_t *record) {
     static uint32_t key_timer;
 
     switch (keycode) {
@@ -219,7 +372,7 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
             return false;
         case L_T_BR:
             if (record->event.pressed) {
-                led_set_animation_breathing(!led_animation_breathing);
+                led_set_animation_breathing(!led_anim_breathing);
             }
             return false;
         case L_T_PTD:
@@ -229,7 +382,8 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
             return false;
         case U_T_AGCR:
             if (record->event.pressed && MODS_SHIFT && MODS_CTRL) {
-                TOGGLE_FLAG_AND_PRINT(usb_gcr_auto, "USB GCR auto mode");
+                TOGGLE_FLAG_AND_PRINT(led_power_limit, "LED current limit");
+                usb_gcr_auto = !led_power_limit;
             }
             return false;
         case DBG_TOG:
@@ -252,11 +406,47 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
                 TOGGLE_FLAG_AND_PRINT(debug_mouse, "Debug mouse");
             }
             return false;
+        case DBG_PRF:
+            if (record->event.pressed) {
+#ifdef CONSOLE_ENABLE
+                uprintf("Scan %lu Hz, LED %lu fps every %u ms\n",
+                    frame_budget_stats.scan_hz, frame_budget_stats.frame_hz, frame_budget_stats.interval);
+#endif
+                led_flush_print();
+                led_power_print();
+                led_indicator_print();
+                idle_power_print();
+                matrix_scan_print();
+#ifdef PROCESS_RECORD_PROFILE
+                record_profile_print();
+#endif
+#ifdef LATENCY_STATS_ENABLE
+                latency_print();
+#endif
+#ifdef SOF_SYNC_ENABLE
+                sof_sync_print();
+#endif
+#ifdef BINLOG_ENABLE
+                binlog_print();
+#endif
+                unicode_queue_print();
+                task_sched_print();
+                sr_shadow_print();
+                keycode_cache_print();
+#ifdef PIXEL_BENCH
+                pixel_bench();
+#endif
+#ifdef LED_BENCH
+                frame_budget_bench();
+#endif
+            }
+            return false;
         case MD_BOOT:
             if (record->event.pressed) {
                 key_timer = timer_read32();
             } else {
                 if (timer_elapsed32(key_timer) >= 500) {
+                    flush_settings();
                     reset_keyboard();
                 }
             }
@@ -266,3 +456,25 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
     }
 }
 
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    // Before anything can stop the event, so every press and release is seen
+    keycode_cache_record(keycode, record);
+    // Greek glyphs are queued and typed from the main loop
+    if (!process_unicode_queue(keycode, record)) {
+        return false;
+    }
+#ifdef PROCESS_RECORD_PROFILE
+    uint32_t start = dwt_cycles();
+    bool result = process_record_driver(keycode, record);
+    uint32_t cycles = dwt_cycles() - start;
+
+    record_profile.events++;
+    record_profile.cycles_total += cycles;
+    if (cycles > record_profile.cycles_max) {
+        record_profile.cycles_max = cycles;
+    }
+    return result;
+#else
+    return process_record_driver(keycode, record);
+#endif
+}
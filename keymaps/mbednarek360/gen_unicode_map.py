@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""Generate unicode_map_gen.h from the symbol list in unicode_symbols.txt.
+
+Code points are stored as 16-bit offsets from a 32-bit base shared by each
+block of 2^UNICODE_BLOCK_SHIFT entries, so a lookup is one table read per
+array. A symbol and its shifted form (its upper case unless given
+explicitly) sit next to each other and are flagged in a bitmap. Every
+symbol gets a UC_SYM() keycode macro named after it. UC_SYM() is defined
+here rather than using QMK's X(), which only exists with UNICODEMAP_ENABLE,
+and unicode_queue.c handles these keycodes instead of process_unicodemap.
+
+Run from the keymap directory (build.sh does this before compiling):
+    ./gen_unicode_map.py
+"""
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "unicode_symbols.txt")
+OUTPUT = os.path.join(HERE, "unicode_map_gen.h")
+
+OFFSET_MAX = 0xFFFF
+# UC_SYM() keycodes carry a 14 bit index, the same range as QMK's X()
+INDEX_MAX = 0x3FFF
+BLOCK_SHIFTS = range(0, 9)
+
+
+def code_point(text, line):
+    if text.upper().startswith("U+"):
+        return int(text[2:], 16)
+    if len(text) != 1:
+        sys.exit("{}: expected one character or U+XXXX, got '{}'".format(line, text))
+    return ord(text)
+
+
+def parse(text):
+    symbols = []
+    names = set()
+    for line, raw in enumerate(text.splitlines(), 1):
+        fields = raw.split("#", 1)[0].split()
+        if not fields:
+            continue
+        if len(fields) not in (2, 3):
+            sys.exit("{}: expected NAME symbol [shifted symbol]".format(line))
+        name = fields[0]
+        if name in names:
+            sys.exit("{}: {} defined twice".format(line, name))
+        names.add(name)
+
+        lower = code_point(fields[1], line)
+        if len(fields) == 3:
+            upper = code_point(fields[2], line)
+        else:
+            # Case pairs are only derived when they map one to one
+            upper = chr(lower).upper()
+            upper = ord(upper) if len(upper) == 1 and ord(upper) != lower else None
+        symbols.append({"name": name, "points": [lower] if upper is None else [lower, upper]})
+    return symbols
+
+
+def layout(symbols, shift):
+    """Places symbols by code point into blocks, padding where a block would span more than 16 bits."""
+    size = 1 << shift
+    entries = []
+
+    def fits(points):
+        # Only the last block and any it spills into can change
+        trial = entries + points
+        for start in range(len(entries) - len(entries) % size, len(trial), size):
+            block = [p for p in trial[start:start + size] if p is not None]
+            if max(block) - min(block) > OFFSET_MAX:
+                return False
+        return True
+
+    for symbol in sorted(symbols, key=lambda s: min(s["points"])):
+        if not fits(symbol["points"]):
+            entries.extend([None] * (-len(entries) % size))
+        symbol["index"] = len(entries)
+        entries.extend(symbol["points"])
+
+    bases = []
+    for start in range(0, len(entries), size):
+        block = [p for p in entries[start:start + size] if p is not None]
+        bases.append(min(block) if block else 0)
+    offsets = [0 if p is None else p - bases[i >> shift] for i, p in enumerate(entries)]
+    pairs = [0] * ((len(entries) + 7) // 8)
+    for symbol in symbols:
+        if len(symbol["points"]) == 2:
+            pairs[symbol["index"] // 8] |= 1 << (symbol["index"] % 8)
+    return bases, offsets, pairs
+
+
+def table_bytes(bases, offsets, pairs):
+    return len(bases) * 4 + len(offsets) * 2 + len(pairs)
+
+
+def generate(symbols):
+    if not symbols:
+        sys.exit("No symbols in unicode_symbols.txt")
+
+    # Smallest tables win, the shift only decides how often a new base is stored
+    best = None
+    for shift in BLOCK_SHIFTS:
+        tables = layout(symbols, shift)
+        if best is None or table_bytes(*tables) < table_bytes(*best[1]):
+            best = (shift, tables)
+    shift, (bases, offsets, pairs) = best
+    layout(symbols, shift)
+    if len(offsets) - 1 > INDEX_MAX:
+        sys.exit("{} entries do not fit UC_SYM() keycodes".format(len(offsets)))
+
+    def table(values, per_line=12):
+        lines = []
+        for start in range(0, len(values), per_line):
+            lines.append("    " + ", ".join(values[start:start + per_line]) + ",")
+        return " \\\n".join(lines)
+
+    def define(name, comment, body):
+        return "//{}\n#define {} {{ \\\n{} \\\n}}\n".format(comment, name, body)
+
+    width = max(len(s["name"]) for s in symbols)
+    keycodes = []
+    for symbol in symbols:
+        glyphs = " ".join(chr(p) for p in symbol["points"])
+        keycodes.append("#define {:{}} UC_SYM({}) // {}".format(symbol["name"], width, symbol["index"], glyphs))
+
+    out = [
+        "// Generated by gen_unicode_map.py from unicode_symbols.txt, do not edit",
+        "",
+        "#pragma once",
+        "",
+        "#define UNICODE_BLOCK_SHIFT {}".format(shift),
+        "#define UNICODE_MAP_SIZE {}".format(len(offsets)),
+        "",
+        define("UNICODE_BLOCK_BASES", "Lowest code point in each block", table(["0x{:05X}".format(b) for b in bases], 8)),
+        define("UNICODE_OFFSETS", "Code point minus its block base", table(["0x{:04X}".format(o) for o in offsets])),
+        define("UNICODE_PAIRS", "Bit per entry, set when the next entry is its shifted form", table(["0x{:02X}".format(p) for p in pairs])),
+        "//Keycode of the symbol at a table index, handled by process_unicode_queue",
+        "#define UC_SYM(i) (QK_UNICODEMAP | (i))",
+        "",
+        "\n".join(keycodes),
+        "",
+    ]
+    return "\n".join(out), table_bytes(bases, offsets, pairs)
+
+
+def main():
+    with open(SOURCE, encoding="utf-8") as f:
+        symbols = parse(f.read())
+    text, size = generate(symbols)
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write(text)
+
+    points = sum(len(s["points"]) for s in symbols)
+    print("unicode_map_gen.h: {} symbols, {} code points in {} bytes ({} bytes as uint32_t)".format(
+        len(symbols), points, size, points * 4))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,52 +0,0 @@
-#define GK_A XP(0, 1) // alpha
-#define GK_B XP(2, 3) // beta
-#define GK_G XP(4, 5) // gamma
-#define GK_D XP(6, 7) // delta
-#define GK_E XP(8, 9) // epsilon 
-#define GK_Z XP(10, 11) // zeta 
-#define GK_H XP(12, 13) // eta 
-#define GK_U XP(14, 15) // theta 
-#define GK_I XP(16, 17) // iota
-#define GK_K XP(18, 19) // kappa 
-#define GK_L XP(20, 21) // lambda
-#define GK_M XP(22, 23) // mu
-#define GK_N XP(24, 25) // nu
-#define GK_J XP(26, 27) // xi
-#define GK_O XP(28, 29) // omnicron
-#define GK_P XP(30, 31) // pi 
-#define GK_R XP(32, 33) // rho
-#define GK_S XP(34, 35) // sigma
-#define GK_T XP(36, 37) // tau
-#define GK_Y XP(38, 39) // upsilon
-#define GK_F XP(40, 41) // phi
-#define GK_X XP(42, 43) // chi
-#define GK_C XP(44, 45) // psi
-#define GK_V XP(46, 47) // omega
-
-// lower, upper
-const uint32_t PROGMEM unicode_map[] = {
-    0x03b1, 0x0391,
-    0x03b2, 0x0392,
-    0x03b3, 0x0393,
-    0x03b4, 0x0394,
-    0x03b5, 0x0395,
-    0x03b6, 0x0396,
-    0x03b7, 0x0397,
-    0x03b8, 0x0398,
-    0x03b9, 0x0399,
-    0x03ba, 0x039a,
-    0x03bb, 0x039b,
-    0x03bc, 0x039c,
-    0x03bd, 0x039d,
-    0x03be, 0x039e,
-    0x03bf, 0x039f,
-    0x03c0, 0x03a0,
-    0x03c1, 0x03a1,
-    0x03c3, 0x03a3,
-    0x03c4, 0x03a4,
-    0x03c5, 0x03a5,
-    0x03c6, 0x03a6,
-    0x03c7, 0x03a7,
-    0x03c8, 0x03a8,
-    0x03c9, 0x03a9,
-};
@@ -1,5 +1,5 @@
 #include <./driver.c>
-#include <./greek.h>
+#include <./unicode_map_gen.h>
 
 const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     [0] = LAYOUT( // Primary layer
@@ -24,15 +24,16 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
         _______, _______, _______,                            _______,                            _______, _______, _______, _______, _______  \
     ),
     [3] = LAYOUT( // Greek / math layer
-        _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, \
-        _______, _______, _______, GK_E,    GK_R,    GK_T,    GK_Y,    GK_U,    GK_I,    GK_O,    GK_P,    _______, _______, _______, _______, \
-        _______, GK_A,    GK_S,    GK_D,    GK_F,    GK_G,    GK_H,    GK_J,    GK_K,    GK_L,    _______, _______,          _______, _______, \
-        _______, GK_Z,    GK_X,    GK_C,    GK_V,    GK_B,    GK_N,    GK_M,    _______, _______, _______, _______,          _______, _______, \
+        _______, MT_ALL,  MT_EX,   MT_IN,   MT_EMPT, MT_INF,  MT_PART, MT_NABL, MT_SUM,  MT_INT,  MT_SQRT, MT_PM,   MT_NEQ,  _______, _______, \
+        _______, MT_AND,  MT_OR,   GK_E,    GK_R,    GK_T,    GK_Y,    GK_U,    GK_I,    GK_O,    GK_P,    MT_SUB,  MT_SUP,  MT_SETM, _______, \
+        _______, GK_A,    GK_S,    GK_D,    GK_F,    GK_G,    GK_H,    GK_J,    GK_K,    GK_L,    MT_APRX, MT_DOT,           _______, _______, \
+        _______, GK_Z,    GK_X,    GK_C,    GK_V,    GK_B,    GK_N,    GK_M,    MT_LE,   MT_GE,   MT_RARR, _______,          _______, _______, \
         _______, _______, _______,                            _______,                            _______, _______, _______, _______, _______  \
     )    
 };
 
-led_instruction_t led_instructions[] = {
+// Source instructions, compiled per layer into led_instructions below
+const led_instruction_t led_instruction_set[] = {
     //LEDs are normally inactive, no processing is performed on them
     //Flags are used in matching criteria for an LED to be active and indicate how to color it
     //Flags can be found in tmk_core/protocol/arm_atsam/led_matrix.h (prefixed with LED_FLAG_)
@@ -70,12 +71,249 @@ led_instruction_t led_instructions[] = {
 
     //end must be set to 1 to indicate end of instruction set
      { .end = 1 }
-};                                                                   
+};
 
-// Runs just one time when the keyboard initializes.
-void matrix_init_user(void) {
+// Keys lit while a layer is on, drawn over the pattern by led_indicator.c. Scan
+// codes are key matrix codes, like the USB_LED_*_SCANCODE ones in config_led.h.
+const led_layer_indicator_t led_layer_indicators[] = {
+    { .layer = 2, .scan = 66, .g = 255, .b = 64 },  // Qwerty, on the space bar where TG(2) sits
+    { .layer = 3, .scan = 70, .r = 64, .b = 255 },  // Greek / math, on its OSL(3) key
+    { .end = 1 }
 };
 
-// Runs constantly in the background, in a loop.
-void matrix_scan_user(void) {
+#define LED_INSTRUCTION_SET_SIZE (sizeof(led_instruction_set) / sizeof(led_instruction_set[0]))
+
+// What the Massdrop renderer walks for every LED on every frame. Holds only the
+// instructions that take effect on the active layer, with layer matches
+// resolved and each id mask narrowed to the LEDs the instruction still affects,
+// so the per-frame cost does not grow with layer-specific entries above.
+led_instruction_t led_instructions[LED_INSTRUCTION_SET_SIZE];
+
+static uint8_t led_instructions_layer = 0xFF;
+
+static bool led_instruction_matches(const led_instruction_t *instruction, uint8_t led, uint8_t layer) {
+    if ((instruction->flags & LED_FLAG_MATCH_LAYER) && instruction->layer != layer) {
+        return false;
+    }
+    if (instruction->flags & LED_FLAG_MATCH_ID) {
+        const uint32_t *bitfield = &instruction->id0 + led / 32;
+        return *bitfield & (1UL << (led % 32));
+    }
+    return true;
+}
+
+void led_instructions_compile(uint8_t layer) {
+    uint32_t masks[LED_INSTRUCTION_SET_SIZE][4] = { { 0 } };
+    uint8_t count = 0;
+
+    if (layer == led_instructions_layer) {
+        return;
+    }
+    led_instructions_layer = layer;
+
+    // Replay the renderer per LED: a fixed colour replaces whatever came before
+    // it, while patterns add on top, so only instructions after the last
+    // matching colour can still affect the LED
+    for (uint8_t led = 0; led < ISSI3733_LED_COUNT; led++) {
+        uint32_t bit = 1UL << (led % 32);
+
+        for (uint8_t n = 0; !led_instruction_set[n].end; n++) {
+            const led_instruction_t *instruction = &led_instruction_set[n];
+
+            if (!led_instruction_matches(instruction, led, layer)) {
+                continue;
+            }
+            if (instruction->flags & LED_FLAG_USE_RGB) {
+                for (uint8_t prev = 0; prev < n; prev++) {
+                    masks[prev][led / 32] &= ~bit;
+                }
+            } else if (!(instruction->flags & (LED_FLAG_USE_PATTERN | LED_FLAG_USE_ROTATE_PATTERN))) {
+                continue;
+            }
+            masks[n][led / 32] |= bit;
+        }
+    }
+
+    for (uint8_t n = 0; !led_instruction_set[n].end; n++) {
+        bool all = true;
+        bool any = false;
+
+        for (uint8_t word = 0; word < 4; word++) {
+            uint8_t leds = ISSI3733_LED_COUNT > word * 32 ? ISSI3733_LED_COUNT - word * 32 : 0;
+            uint32_t full = leds >= 32 ? 0xFFFFFFFF : (1UL << leds) - 1;
+
+            any |= masks[n][word] != 0;
+            all &= masks[n][word] == full;
+        }
+        if (!any) {
+            continue;
+        }
+
+        led_instruction_t *compiled = &led_instructions[count++];
+        *compiled = led_instruction_set[n];
+        compiled->flags &= ~(LED_FLAG_MATCH_LAYER | LED_FLAG_MATCH_ID);
+        if (!all) {
+            compiled->flags |= LED_FLAG_MATCH_ID;
+            compiled->id0 = masks[n][0];
+            compiled->id1 = masks[n][1];
+            compiled->id2 = masks[n][2];
+            compiled->id3 = masks[n][3];
+        }
+    }
+    led_instructions[count] = (led_instruction_t){ .end = 1 };
+}
+
+#define KEYMAP_LAYERS (sizeof(keymaps) / sizeof(keymaps[0]))
+
+_Static_assert(KEYMAP_LAYERS <= sizeof(layer_state_t) * 8, "More keymap layers than layer_state_t has bits");
+_Static_assert(sizeof(keymaps[0]) == sizeof(uint16_t[MATRIX_ROWS][MATRIX_COLS]), "Keymap layers do not match the matrix");
+
+// What every key resolves to on the active layers, so a key event reads one
+// entry instead of walking the layer stack. Rebuilt whenever the layer state
+// changes, by painting the active layers over each other from the bottom up.
+static uint16_t keycodes[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t keycodes_layer;
+static layer_state_t keycodes_state;
+
+// What the table answered for each held key's press, and on which layer.
+// QMK records that layer and looks the release up on it, by which time the
+// table may have been rebuilt for another stack under the same top layer.
+static uint16_t held_keycodes[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t held_layers[MATRIX_ROWS][MATRIX_COLS];
+static uint16_t held_rows[MATRIX_ROWS];
+
+_Static_assert(MATRIX_COLS <= 16, "Held keys are one bit per column");
+
+typedef struct {
+    uint32_t rebuilds;  // Layer state changes
+    uint32_t held;      // Lookups answered with what a held key was pressed as
+    uint32_t direct;    // Lookups for a layer other than the top one
+} keycode_cache_stats_t;
+
+keycode_cache_stats_t keycode_cache_stats;
+
+static bool keymap_layer_active(uint8_t layer, layer_state_t state) {
+    return layer < KEYMAP_LAYERS && (state & ((layer_state_t)1 << layer));
+}
+
+#ifdef CONSOLE_ENABLE
+// The stack walk of layer_switch_get_layer, starting at the given layer:
+// the first active entry that is not transparent, else the base layer's
+static uint16_t keycode_walk(uint8_t layer, layer_state_t state, uint8_t row, uint8_t col) {
+    for (int8_t i = layer; i >= 0; i--) {
+        if (i != layer && !keymap_layer_active(i, state)) {
+            continue;
+        }
+        if ((uint8_t)i < KEYMAP_LAYERS) {
+            uint16_t keycode = pgm_read_word(&keymaps[i][row][col]);
+
+            if (keycode != KC_TRNS) {
+                return keycode;
+            }
+        }
+    }
+    return pgm_read_word(&keymaps[0][row][col]);
+}
+#endif
+
+// Takes the default layers or'ed in, as layer_switch_get_layer sees them
+static void keycode_cache_build(layer_state_t state) {
+    if (state == keycodes_state) {
+        return;
+    }
+    keycodes_state = state;
+    keycodes_layer = get_highest_layer(state);
+    keycode_cache_stats.rebuilds++;
+
+    memcpy_P(keycodes, keymaps[0], sizeof(keycodes));
+    for (uint8_t layer = 1; layer < KEYMAP_LAYERS; layer++) {
+        if (!keymap_layer_active(layer, state)) {
+            continue;
+        }
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint16_t keycode = pgm_read_word(&keymaps[layer][row][col]);
+
+                if (keycode != KC_TRNS) {
+                    keycodes[row][col] = keycode;
+                }
+            }
+        }
+    }
+}
+
+// QMK looks the top active layer up first, which now never comes back
+// transparent, so layer_switch_get_layer stops there and the key's source
+// layer cache records it. A held key keeps what its press was answered with
+// on that layer. Any other layer gets exactly its own entry, as QMK expects.
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+    if ((held_rows[key.row] & (1 << key.col)) && layer == held_layers[key.row][key.col]) {
+        keycode_cache_stats.held++;
+        return held_keycodes[key.row][key.col];
+    }
+    if (layer == keycodes_layer) {
+        return keycodes[key.row][key.col];
+    }
+    keycode_cache_stats.direct++;
+    return layer < KEYMAP_LAYERS ? pgm_read_word(&keymaps[layer][key.row][key.col]) : KC_TRNS;
+}
+
+// From process_record_user, with the keycode the event was looked up as
+void keycode_cache_record(uint16_t keycode, keyrecord_t *record) {
+    keypos_t key = record->event.key;
+
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return;
+    }
+    if (record->event.pressed) {
+        held_keycodes[key.row][key.col] = keycode;
+        held_layers[key.row][key.col] = keycodes_layer;
+        held_rows[key.row] |= 1 << key.col;
+    } else {
+        held_rows[key.row] &= ~(1 << key.col);
+    }
+}
+
+void keycode_cache_print(void) {
+#ifdef CONSOLE_ENABLE
+    uint16_t mismatches = 0;
+
+    // Check the painted table against the stack walk for the current state
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (keycodes[row][col] != keycode_walk(keycodes_layer, keycodes_state, row, col)) {
+                mismatches++;
+            }
+        }
+    }
+    uprintf("Keycode cache:\n");
+    uprintf("  rebuilds %lu held %lu direct %lu\n", keycode_cache_stats.rebuilds, keycode_cache_stats.held,
+        keycode_cache_stats.direct);
+    uprintf("  layer %u state %08lX %s\n", keycodes_layer, (uint32_t)keycodes_state, mismatches ? "MISMATCH" : "ok");
+#endif
+    keycode_cache_stats = (keycode_cache_stats_t){ 0 };
+}
+
+layer_state_t layer_state_set_user(layer_state_t state) {
+    led_instructions_compile(get_highest_layer(state));
+    keycode_cache_build(state | default_layer_state);
+    return state;
+}
+
+layer_state_t default_layer_state_set_user(layer_state_t state) {
+    keycode_cache_build(layer_state | state);
+    return state;
+}
+
+// Main loop work, run between scans by task_sched.c. A settings commit is a
+// flash write, and now and then a block erase that runs over its budget.
+static TASK_SCHED_TASK(settings_sched, "settings", settings_task, 100, 1000, 5000);
+static TASK_SCHED_TASK(unicode_sched, "unicode", unicode_queue_task, 0, 1, 100);
+
+// Runs just one time when the keyboard initializes.
+void matrix_init_user(void) {
+    led_instructions_compile(get_highest_layer(layer_state));
+    keycode_cache_build(layer_state | default_layer_state);
+    task_sched_add(&settings_sched);
+    task_sched_add(&unicode_sched);
 };
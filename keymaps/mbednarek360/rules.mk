@@ -1,3 +1,7 @@
 # This keymap requires Massdrop Configurator support
 OPT_DEFS += -DUSE_MASSDROP_CONFIGURATOR
-UNICODEMAP_ENABLE = yes
+# Unicode symbols are looked up and typed by unicode_queue.c instead of process_unicodemap
+UNICODEMAP_ENABLE = no
+
+# Queued Unicode output for the Greek layer (unicode_queue.c)
+SRC += unicode_queue.c
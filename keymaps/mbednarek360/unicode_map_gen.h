@@ -0,0 +1,130 @@
+// Generated by gen_unicode_map.py from unicode_symbols.txt, do not edit
+
+#pragma once
+
+#define UNICODE_BLOCK_SHIFT 5
+#define UNICODE_MAP_SIZE 162
+
+//Lowest code point in each block
+#define UNICODE_BLOCK_BASES { \
+    0x000AC, 0x0039A, 0x003A7, 0x02200, 0x0222C, 0x1D53C, \
+}
+
+//Code point minus its block base
+#define UNICODE_OFFSETS { \
+    0x0000, 0x0004, 0x0005, 0x2167, 0x000B, 0x216C, 0x002B, 0x004B, 0x0305, 0x02E5, 0x0306, 0x02E6, \
+    0x0307, 0x02E7, 0x0308, 0x02E8, 0x0309, 0x02E9, 0x0349, 0x02E9, 0x030A, 0x02EA, 0x030B, 0x02EB, \
+    0x030C, 0x02EC, 0x0325, 0x02EC, 0x030D, 0x02ED, 0x030E, 0x02EE, 0x0056, 0x0000, 0x0021, 0x0001, \
+    0x0022, 0x0002, 0x0023, 0x0003, 0x0024, 0x0004, 0x0025, 0x0005, 0x0026, 0x0006, 0x003C, 0x0006, \
+    0x0027, 0x0007, 0x0057, 0x0007, 0x0029, 0x0009, 0x0028, 0x0009, 0x002A, 0x000A, 0x002B, 0x000B, \
+    0x002C, 0x000C, 0x003B, 0x000C, 0x0020, 0x0000, 0x0021, 0x0001, 0x0022, 0x0002, 0x0036, 0x0035, \
+    0x1C79, 0x1C7A, 0x1C8B, 0x1C8C, 0x1D5B, 0x1D68, 0x1D6C, 0x1D6E, 0x1D72, 0x1D73, 0x1D76, 0x1D7D, \
+    0x1D8E, 0x1DE9, 0x1E29, 0x1DEA, 0x1E2A, 0x1DEB, 0x1E2B, 0x1DEC, 0x1E2C, 0x1DED, 0x1E2D, 0x1DFF, \
+    0x0000, 0x0002, 0x0003, 0x0004, 0x0005, 0x0007, 0x0008, 0x0009, 0x000B, 0x000C, 0x000E, 0x0011, \
+    0x000F, 0x0016, 0x0017, 0x00C6, 0x001A, 0x001B, 0x001D, 0x001E, 0x0020, 0x0025, 0x05C2, 0x0027, \
+    0x00C0, 0x0028, 0x00C1, 0x0029, 0x00C2, 0x002A, 0x00C3, 0x002B, 0x0000, 0x0002, 0x0010, 0x0017, \
+    0x001C, 0x0019, 0x0034, 0x0035, 0x0038, 0x003E, 0x0039, 0x003F, 0x0056, 0x005A, 0x0057, 0x005B, \
+    0x0069, 0x006B, 0x0076, 0x007C, 0x0078, 0x0079, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x05BC, 0x05BD, \
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x029D, \
+}
+
+//Bit per entry, set when the next entry is its shifted form
+#define UNICODE_PAIRS { \
+    0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0xA0, 0x2A, \
+    0x44, 0x49, 0xA1, 0xAA, 0x54, 0x55, 0x55, 0x05, 0x00, \
+}
+
+//Keycode of the symbol at a table index, handled by process_unicode_queue
+#define UC_SYM(i) (QK_UNICODEMAP | (i))
+
+#define GK_A     UC_SYM(8) // α Α
+#define GK_B     UC_SYM(10) // β Β
+#define GK_G     UC_SYM(12) // γ Γ
+#define GK_D     UC_SYM(14) // δ Δ
+#define GK_E     UC_SYM(16) // ε Ε
+#define GK_Z     UC_SYM(20) // ζ Ζ
+#define GK_H     UC_SYM(22) // η Η
+#define GK_U     UC_SYM(24) // θ Θ
+#define GK_I     UC_SYM(28) // ι Ι
+#define GK_K     UC_SYM(30) // κ Κ
+#define GK_L     UC_SYM(34) // λ Λ
+#define GK_M     UC_SYM(36) // μ Μ
+#define GK_N     UC_SYM(38) // ν Ν
+#define GK_J     UC_SYM(40) // ξ Ξ
+#define GK_O     UC_SYM(42) // ο Ο
+#define GK_P     UC_SYM(44) // π Π
+#define GK_R     UC_SYM(48) // ρ Ρ
+#define GK_S     UC_SYM(52) // σ Σ
+#define GK_T     UC_SYM(56) // τ Τ
+#define GK_Y     UC_SYM(58) // υ Υ
+#define GK_F     UC_SYM(60) // φ Φ
+#define GK_X     UC_SYM(64) // χ Χ
+#define GK_C     UC_SYM(66) // ψ Ψ
+#define GK_V     UC_SYM(68) // ω Ω
+#define GK_FS    UC_SYM(54) // ς Σ
+#define GK_VEPS  UC_SYM(18) // ϵ Ε
+#define GK_VTH   UC_SYM(26) // ϑ Θ
+#define GK_VPHI  UC_SYM(62) // ϕ Φ
+#define GK_VPI   UC_SYM(46) // ϖ Π
+#define GK_VRHO  UC_SYM(50) // ϱ Ρ
+#define GK_VKAP  UC_SYM(32) // ϰ Κ
+#define GK_DIG   UC_SYM(70) // ϝ Ϝ
+#define MT_ALL   UC_SYM(96) // ∀
+#define MT_EX    UC_SYM(98) // ∃ ∄
+#define MT_IN    UC_SYM(102) // ∈ ∉
+#define MT_NI    UC_SYM(104) // ∋ ∌
+#define MT_EMPT  UC_SYM(100) // ∅
+#define MT_AND   UC_SYM(119) // ∧ ⋀
+#define MT_OR    UC_SYM(121) // ∨ ⋁
+#define MT_NOT   UC_SYM(0) // ¬
+#define MT_XOR   UC_SYM(144) // ⊕ ⊗
+#define MT_SUB   UC_SYM(140) // ⊂ ⊆
+#define MT_SUP   UC_SYM(142) // ⊃ ⊇
+#define MT_CUP   UC_SYM(125) // ∪ ⋃
+#define MT_CAP   UC_SYM(123) // ∩ ⋂
+#define MT_SETM  UC_SYM(109) // ∖
+#define MT_TOP   UC_SYM(148) // ⊤ ⊥
+#define MT_TURN  UC_SYM(146) // ⊢ ⊨
+#define MT_QED   UC_SYM(106) // ∎
+#define MT_ALEF  UC_SYM(84) // ℵ
+#define MT_RARR  UC_SYM(89) // → ⇒
+#define MT_LARR  UC_SYM(85) // ← ⇐
+#define MT_HARR  UC_SYM(93) // ↔ ⇔
+#define MT_MAPS  UC_SYM(95) // ↦
+#define MT_UARR  UC_SYM(87) // ↑ ⇑
+#define MT_DARR  UC_SYM(91) // ↓ ⇓
+#define MT_NEQ   UC_SYM(134) // ≠ ≡
+#define MT_APRX  UC_SYM(132) // ≈ ≅
+#define MT_SIM   UC_SYM(130) // ∼ ≃
+#define MT_LE    UC_SYM(136) // ≤ ≪
+#define MT_GE    UC_SYM(138) // ≥ ≫
+#define MT_PROP  UC_SYM(114) // ∝
+#define MT_PARA  UC_SYM(117) // ∥ ⟂
+#define MT_SUM   UC_SYM(107) // ∑ ∏
+#define MT_INT   UC_SYM(127) // ∫ ∬
+#define MT_OINT  UC_SYM(129) // ∮
+#define MT_PART  UC_SYM(97) // ∂
+#define MT_NABL  UC_SYM(101) // ∇
+#define MT_SQRT  UC_SYM(112) // √ ∛
+#define MT_INF   UC_SYM(115) // ∞
+#define MT_TIME  UC_SYM(6) // × ÷
+#define MT_PM    UC_SYM(2) // ± ∓
+#define MT_DOT   UC_SYM(4) // · ∘
+#define MT_STAR  UC_SYM(110) // ∗ ⋆
+#define MT_DAG   UC_SYM(72) // † ‡
+#define MT_DEG   UC_SYM(1) // °
+#define MT_PRIM  UC_SYM(74) // ′ ″
+#define MT_HBAR  UC_SYM(77) // ℏ
+#define MT_ELL   UC_SYM(78) // ℓ
+#define MT_ANGL  UC_SYM(116) // ∠
+#define MT_LANG  UC_SYM(154) // ⟨ ⟩
+#define MT_FLOR  UC_SYM(152) // ⌊ ⌋
+#define MT_CEIL  UC_SYM(150) // ⌈ ⌉
+#define MT_NAT   UC_SYM(79) // ℕ
+#define MT_INTS  UC_SYM(83) // ℤ
+#define MT_RAT   UC_SYM(81) // ℚ
+#define MT_REAL  UC_SYM(82) // ℝ
+#define MT_CPLX  UC_SYM(76) // ℂ
+#define MT_PRIME UC_SYM(80) // ℙ
+#define MT_EXP   UC_SYM(160) // 𝔼
+#define MT_ONE   UC_SYM(161) // 𝟙
@@ -0,0 +1,335 @@
+#include "unicode_queue.h"
+
+#include "dwt.h"
+#include "unicode_map_gen.h"
+
+// Ctrl+Shift+U, up to eight hex digits and the terminator
+#define UNICODE_KEYS_MAX 10
+// Every key in its own report, plus a blank report between repeated keys
+#define UNICODE_STEPS_MAX (UNICODE_KEYS_MAX * 2)
+
+unicode_queue_stats_t unicode_queue_stats;
+
+// Generated from unicode_symbols.txt, see gen_unicode_map.py
+static const uint32_t PROGMEM unicode_block_bases[] = UNICODE_BLOCK_BASES;
+static const uint16_t PROGMEM unicode_offsets[] = UNICODE_OFFSETS;
+static const uint8_t PROGMEM unicode_pairs[] = UNICODE_PAIRS;
+
+static uint32_t queue[UNICODE_QUEUE_SIZE];
+static uint8_t queue_head;
+static uint8_t queue_tail;
+
+// Key events that arrived while glyphs were queued, in order
+static struct {
+    uint16_t keycode;
+    bool pressed;
+} deferred[UNICODE_DEFER_SIZE];
+static uint8_t deferred_head;
+static uint8_t deferred_tail;
+// Basic keycodes pressed in the deferral queue with their release still to
+// come, and the ones whose press was dropped
+static uint8_t deferred_down[(QK_BASIC_MAX + 1) / 8];
+static uint8_t deferred_open;
+static uint8_t dropped_down[(QK_BASIC_MAX + 1) / 8];
+
+// Reports of the glyph in flight: report n holds key[start[n]] up to key[start[n + 1]]
+static struct {
+    uint8_t key[UNICODE_KEYS_MAX];
+    uint8_t start[UNICODE_STEPS_MAX + 1];
+    bool mods[UNICODE_STEPS_MAX];
+    uint8_t keys;
+    uint8_t count;
+    uint8_t next;
+    uint8_t saved_mods;
+    uint32_t started;
+    uint32_t last_report;
+} glyph;
+
+// Keys down in the last report sent, released by the next one
+static uint8_t held[UNICODE_KEYS_MAX];
+static uint8_t held_count;
+
+static uint8_t hex_to_keycode(uint8_t digit) {
+    if (digit == 0) {
+        return KC_0;
+    }
+    return digit < 10 ? KC_1 + digit - 1 : KC_A + digit - 10;
+}
+
+static bool step_has_key(uint8_t step, uint8_t key) {
+    for (uint8_t i = glyph.start[step]; i < glyph.start[step + 1]; i++) {
+        if (glyph.key[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void glyph_new_step(bool mods) {
+    glyph.mods[glyph.count++] = mods;
+    glyph.start[glyph.count] = glyph.keys;
+}
+
+// The NKRO bitmap is processed by the host in usage order, so keys pressed in
+// one report are typed lowest keycode first. A key joins the current report
+// while that keeps the order, otherwise it starts the next one. A key still
+// held from the previous report would not register, so it gets a blank one
+// in between.
+static void glyph_add(uint8_t key, bool mods) {
+    uint8_t last = glyph.count - 1;
+    bool append = glyph.count
+        && keymap_config.nkro
+        && !mods && !glyph.mods[last]
+        && glyph.key[glyph.keys - 1] < key
+        && !(last && step_has_key(last - 1, key));
+
+    if (!append) {
+        if (glyph.count && step_has_key(last, key)) {
+            glyph_new_step(false);
+        }
+        glyph_new_step(mods);
+    }
+    glyph.key[glyph.keys++] = key;
+    glyph.start[glyph.count] = glyph.keys;
+}
+
+// Same digits as register_hex32: leading zeros dropped, but at least four
+static void glyph_start(uint32_t code_point) {
+    glyph.keys = 0;
+    glyph.count = 0;
+    glyph.next = 0;
+    glyph.start[0] = 0;
+    glyph.started = dwt_cycles();
+
+    glyph_add(KC_U, true);
+    for (int8_t i = 7; i >= 0; i--) {
+        uint8_t digit = (code_point >> (i * 4)) & 0xF;
+
+        if (digit || i <= 3 || glyph.keys > 1) {
+            glyph_add(hex_to_keycode(digit), false);
+        }
+    }
+    glyph_add(KC_SPC, false);
+}
+
+static bool queue_empty(void) {
+    return queue_head == queue_tail;
+}
+
+static bool glyphs_pending(void) {
+    return glyph.count || !queue_empty();
+}
+
+static bool deferred_empty(void) {
+    return deferred_head == deferred_tail;
+}
+
+bool unicode_queue_busy(void) {
+    return glyphs_pending() || !deferred_empty();
+}
+
+static void send_report(uint8_t mods) {
+    set_mods(mods);
+    send_keyboard_report();
+    glyph.last_report = dwt_cycles();
+    unicode_queue_stats.reports++;
+}
+
+static void release_held(void) {
+    for (uint8_t i = 0; i < held_count; i++) {
+        del_key(held[i]);
+    }
+    held_count = 0;
+}
+
+static void send_step(void) {
+    release_held();
+    for (uint8_t i = glyph.start[glyph.next]; i < glyph.start[glyph.next + 1]; i++) {
+        add_key(glyph.key[i]);
+        held[held_count++] = glyph.key[i];
+    }
+    send_report(glyph.mods[glyph.next] ? MOD_BIT(KC_LCTL) | MOD_BIT(KC_LSFT) : 0);
+    glyph.next++;
+}
+
+static void finish_glyph(void) {
+    unicode_queue_stats.glyphs++;
+    unicode_queue_stats.busy_cycles += dwt_cycles() - glyph.started;
+    glyph.count = 0;
+
+    // Last glyph out, release its terminator and put the user's modifiers back
+    if (queue_empty()) {
+        release_held();
+        send_report(glyph.saved_mods);
+    }
+}
+
+static void unicode_queue_push(uint32_t code_point);
+static uint32_t unicode_code_point(uint16_t index);
+
+static bool is_symbol(uint16_t keycode) {
+    return keycode >= QK_UNICODEMAP && keycode < QK_UNICODEMAP + UNICODE_MAP_SIZE;
+}
+
+static bool bit_test(const uint8_t *bits, uint8_t keycode) {
+    return bits[keycode / 8] & (1 << (keycode % 8));
+}
+
+static void bit_set(uint8_t *bits, uint8_t keycode, bool set) {
+    if (set) {
+        bits[keycode / 8] |= 1 << (keycode % 8);
+    } else {
+        bits[keycode / 8] &= ~(1 << (keycode % 8));
+    }
+}
+
+static void defer_push(uint16_t keycode, bool pressed) {
+    deferred[deferred_head].keycode = keycode;
+    deferred[deferred_head].pressed = pressed;
+    deferred_head = (deferred_head + 1) % UNICODE_DEFER_SIZE;
+}
+
+// Holds a key event back behind the glyphs, returns false when it has to go
+// through at once. The record path never waits for the queue to drain: once
+// only the room for the releases of held back presses is left, presses are
+// dropped, and so are their releases.
+static bool defer(uint16_t keycode, bool pressed) {
+    uint8_t room = (deferred_tail + UNICODE_DEFER_SIZE - deferred_head - 1) % UNICODE_DEFER_SIZE;
+
+    if (keycode > QK_BASIC_MAX) {
+        // Symbols type on the press only
+        if (pressed && room > deferred_open) {
+            defer_push(keycode, true);
+        } else if (pressed) {
+            unicode_queue_stats.overflows++;
+        }
+        return true;
+    }
+    if (pressed) {
+        if (room <= deferred_open + 1) {
+            bit_set(dropped_down, keycode, true);
+            unicode_queue_stats.overflows++;
+            return true;
+        }
+        bit_set(deferred_down, keycode, true);
+        deferred_open++;
+        defer_push(keycode, true);
+        return true;
+    }
+    if (bit_test(dropped_down, keycode)) {
+        bit_set(dropped_down, keycode, false);
+        return true;
+    }
+    if (bit_test(deferred_down, keycode)) {
+        bit_set(deferred_down, keycode, false);
+        deferred_open--;
+    } else if (room <= deferred_open) {
+        // Pressed before the glyphs, the host already has the press
+        return false;
+    }
+    defer_push(keycode, false);
+    return true;
+}
+
+// Replays the oldest held back event, a symbol goes back on the glyph queue
+// and holds up the events behind it in turn
+static void replay(void) {
+    uint16_t keycode = deferred[deferred_tail].keycode;
+    bool pressed = deferred[deferred_tail].pressed;
+
+    deferred_tail = (deferred_tail + 1) % UNICODE_DEFER_SIZE;
+    unicode_queue_stats.deferred++;
+    if (is_symbol(keycode)) {
+        if (pressed) {
+            unicode_queue_push(unicode_code_point(keycode - QK_UNICODEMAP));
+        }
+        return;
+    }
+    if (pressed) {
+        register_code(keycode);
+    } else {
+        unregister_code(keycode);
+    }
+    glyph.last_report = dwt_cycles();
+}
+
+void unicode_queue_task(void) {
+    if (!unicode_queue_busy() || dwt_cycles() - glyph.last_report < UNICODE_QUEUE_REPORT_US * DWT_CYCLES_PER_US) {
+        return;
+    }
+
+    if (!glyphs_pending()) {
+        replay();
+        return;
+    }
+    if (!glyph.count) {
+        glyph_start(queue[queue_tail]);
+        queue_tail = (queue_tail + 1) % UNICODE_QUEUE_SIZE;
+    }
+    send_step();
+    if (glyph.next == glyph.count) {
+        finish_glyph();
+    }
+}
+
+static void unicode_queue_push(uint32_t code_point) {
+    uint8_t head = (queue_head + 1) % UNICODE_QUEUE_SIZE;
+
+    if (head == queue_tail) {
+        unicode_queue_stats.dropped++;
+        return;
+    }
+    if (!glyphs_pending()) {
+        glyph.saved_mods = get_mods();
+    }
+    queue[queue_head] = code_point;
+    queue_head = head;
+}
+
+// Shifted form with Shift xor Caps Lock, like the upper case of an XP() pair
+static uint32_t unicode_code_point(uint16_t index) {
+    if (pgm_read_byte(unicode_pairs + index / 8) & (1 << (index % 8))) {
+        uint8_t mods = glyphs_pending() ? glyph.saved_mods : get_mods();
+        bool shift = mods & (MOD_BIT(KC_LSHIFT) | MOD_BIT(KC_RSHIFT));
+        bool caps = host_keyboard_led_state().caps_lock;
+
+        if (shift ^ caps) {
+            index++;
+        }
+    }
+    return pgm_read_dword(unicode_block_bases + (index >> UNICODE_BLOCK_SHIFT)) + pgm_read_word(unicode_offsets + index);
+}
+
+bool process_unicode_queue(uint16_t keycode, keyrecord_t *record) {
+    bool symbol = is_symbol(keycode);
+
+    // Basic keys have to land after the glyphs typed before them, and so do
+    // symbols once other keys are waiting. Layer and settings keys type
+    // nothing and go through at once.
+    if (symbol ? !deferred_empty() : keycode <= QK_BASIC_MAX && unicode_queue_busy()) {
+        if (defer(keycode, record->event.pressed)) {
+            return false;
+        }
+    }
+
+    if (symbol) {
+        if (record->event.pressed) {
+            unicode_queue_push(unicode_code_point(keycode - QK_UNICODEMAP));
+        }
+        return false;
+    }
+    return true;
+}
+
+void unicode_queue_print(void) {
+#ifdef CONSOLE_ENABLE
+    uint32_t busy_us = (uint32_t)(unicode_queue_stats.busy_cycles / DWT_CYCLES_PER_US);
+
+    uprintf("Unicode queue:\n");
+    uprintf("  glyphs %lu reports %lu dropped %lu\n",
+        unicode_queue_stats.glyphs, unicode_queue_stats.reports, unicode_queue_stats.dropped);
+    uprintf("  key events deferred %lu presses dropped %lu\n", unicode_queue_stats.deferred, unicode_queue_stats.overflows);
+    uprintf("  glyphs/sec %lu\n", busy_us ? (uint32_t)((uint64_t)unicode_queue_stats.glyphs * 1000000 / busy_us) : 0);
+#endif
+    unicode_queue_stats = (unicode_queue_stats_t){ 0 };
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Queued, non-blocking Unicode input for UC_LNX (Ctrl+Shift+U, hex digits, space).
+// Glyphs are sent from the main loop, one report per USB frame. Each report
+// releases the keys of the previous one, and with NKRO presses every following
+// digit that the host will still type in order, so most glyphs take five reports.
+// Keys that type something while glyphs are still going out wait in a second
+// queue and are replayed behind them, so the record path never blocks on it.
+
+#ifndef UNICODE_QUEUE_SIZE
+#define UNICODE_QUEUE_SIZE 16
+#endif
+
+// Key events held back behind queued glyphs. A press that does not fit is
+// dropped along with its release, room is always kept for the releases of
+// the presses it holds.
+#ifndef UNICODE_DEFER_SIZE
+#define UNICODE_DEFER_SIZE 32
+#endif
+
+// Spacing between reports, the ALT is polled once per 1 ms frame
+#ifndef UNICODE_QUEUE_REPORT_US
+#define UNICODE_QUEUE_REPORT_US 1000
+#endif
+
+typedef struct {
+    uint32_t glyphs;        // Glyphs fully emitted
+    uint32_t reports;       // Keyboard reports sent for them
+    uint32_t dropped;       // Glyphs lost to a full queue
+    uint32_t deferred;      // Key events replayed behind glyphs
+    uint32_t overflows;     // Key presses dropped to a full deferral queue
+    uint64_t busy_cycles;   // Time spent with a glyph in flight
+} unicode_queue_stats_t;
+
+extern unicode_queue_stats_t unicode_queue_stats;
+
+// Handles the UC_SYM() keycodes from unicode_map_gen.h, returns false when the keycode was consumed
+bool process_unicode_queue(uint16_t keycode, keyrecord_t *record);
+// Sends the next report or replays the next held back key event if one is due, call from the main loop
+void unicode_queue_task(void);
+// True while glyphs or held back key events are waiting
+bool unicode_queue_busy(void);
+void unicode_queue_print(void);
@@ -0,0 +1,105 @@
+#include "latency.h"
+
+#include <string.h>
+#include "quantum.h"
+#include "dwt.h"
+#ifdef SOF_SYNC_ENABLE
+#include "sof_sync.h"
+#endif
+
+extern matrix_row_t raw_matrix[MATRIX_ROWS];
+
+latency_stats_t latency_stats;
+
+static uint32_t last_scan;
+static bool scanned;
+static matrix_row_t last_raw[MATRIX_ROWS];
+static matrix_row_t last_cooked[MATRIX_ROWS];
+static uint32_t edge_time[MATRIX_ROWS][MATRIX_COLS];
+static uint32_t report_edge;
+static bool report_pending;
+
+static void hist_add(latency_hist_t *hist, uint32_t cycles) {
+    uint32_t us = cycles / DWT_CYCLES_PER_US;
+    uint8_t bucket = us ? 32 - __builtin_clz(us) : 0;
+
+    hist->bucket[bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1]++;
+    hist->count++;
+    if (us > hist->max_us) {
+        hist->max_us = us;
+    }
+}
+
+void latency_scan(void) {
+    uint32_t now = dwt_cycles();
+
+    //The first scan has no previous one to measure from
+    if (scanned) {
+        hist_add(&latency_stats.scan, now - last_scan);
+    }
+    scanned = true;
+    last_scan = now;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t raw = raw_matrix[row];
+        matrix_row_t cooked = matrix_get_row(row);
+        matrix_row_t edges = raw ^ last_raw[row];
+        matrix_row_t changes = cooked ^ last_cooked[row];
+
+        //Nearly every scan ends here
+        if (!(edges | changes)) {
+            continue;
+        }
+
+        //Only the first edge away from the debounced state is timestamped, later bounces keep it
+        matrix_row_t settled = ~(last_raw[row] ^ last_cooked[row]);
+        for (edges &= settled; edges; edges &= edges - 1) {
+            edge_time[row][__builtin_ctz(edges)] = now;
+        }
+        last_raw[row] = raw;
+        last_cooked[row] = cooked;
+
+        for (; changes; changes &= changes - 1) {
+            uint32_t edge = edge_time[row][__builtin_ctz(changes)];
+
+            hist_add(&latency_stats.debounce, now - edge);
+            if (!report_pending || (int32_t)(edge - report_edge) < 0) {
+                report_edge = edge;
+            }
+            report_pending = true;
+        }
+    }
+}
+
+void latency_report(void) {
+    if (report_pending) {
+        hist_add(&latency_stats.report, dwt_cycles() - report_edge);
+#ifdef SOF_SYNC_ENABLE
+        hist_add(&latency_stats.sof, sof_sync_next() - report_edge);
+#endif
+        report_pending = false;
+    }
+}
+
+#ifdef CONSOLE_ENABLE
+static void hist_print(const char *name, const latency_hist_t *hist) {
+    uprintf("%s: %lu samples, max %lu us\n", name, hist->count, hist->max_us);
+    for (uint8_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+        if (hist->bucket[bucket]) {
+            uprintf("  < %lu us: %lu\n", 1UL << bucket, hist->bucket[bucket]);
+        }
+    }
+}
+#endif
+
+void latency_print(void) {
+#ifdef CONSOLE_ENABLE
+    hist_print("Scan period", &latency_stats.scan);
+    hist_print("Edge to debounced", &latency_stats.debounce);
+    hist_print("Edge to report", &latency_stats.report);
+#ifdef SOF_SYNC_ENABLE
+    hist_print("Edge to SOF", &latency_stats.sof);
+#endif
+#endif
+    memset(&latency_stats, 0, sizeof(latency_stats));
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+//Opt-in latency instrumentation (LATENCY_STATS_ENABLE in config.h)
+//Stages are timestamped with the DWT cycle counter and binned into fixed power-of-two histograms in RAM
+#define LATENCY_BUCKETS             16          //Bucket n counts samples of 2^(n-1) to 2^n-1 us, the last one everything above
+
+typedef struct {
+    uint32_t count;
+    uint32_t max_us;
+    uint32_t bucket[LATENCY_BUCKETS];
+} latency_hist_t;
+
+typedef struct {
+    latency_hist_t scan;        //Time between consecutive matrix scans
+    latency_hist_t debounce;    //Raw key edge to debounced matrix change
+    latency_hist_t report;      //Raw key edge to the end of the keyboard task that sent its report
+#ifdef SOF_SYNC_ENABLE
+    latency_hist_t sof;         //Raw key edge to the USB frame that carries its report (see sof_sync.h)
+#endif
+} latency_stats_t;
+
+extern latency_stats_t latency_stats;
+
+//From matrix_scan_kb, after the raw and debounced matrices have been updated
+void latency_scan(void);
+//From the main loop after keyboard_task, when any report for the scan has gone out
+void latency_report(void);
+//Dumps the histograms over the console and clears them
+void latency_print(void);
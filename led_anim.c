@@ -0,0 +1,102 @@
+#include "led_anim.h"
+
+#include <string.h>
+#include "quantum.h"
+#include "arm_atsam_protocol.h"
+#include "md_rgb_matrix.h"
+#include "pixel.h"
+#include "led_anim_gen.h"
+
+extern RGB led_buffer[ISSI3733_LED_COUNT];
+
+bool led_anim_breathing;
+
+//One cycle each, the first entry repeated at the end to interpolate across the wrap (see gen_led_anim.py)
+static const int16_t PROGMEM breathe_curve[LED_ANIM_LUT_SIZE + 1] = LED_ANIM_BREATHE;
+static const int16_t PROGMEM sine_curve[LED_ANIM_LUT_SIZE + 1] = LED_ANIM_SINE;
+
+static led_anim_phase_t breathe = { .rate = LED_ANIM_RATE(LED_ANIM_BREATHE_MS) };
+static pixel_frame_t frame;
+static uint8_t gcr_seen;
+static uint8_t gcr_wanted;
+
+_Static_assert(LED_ANIM_LUT_SIZE == 256, "Curves are indexed by the top byte of the phase");
+
+void led_anim_reset(led_anim_phase_t *phase) {
+    phase->phase = 0;
+    phase->timer = timer_read32();
+}
+
+uint32_t led_anim_advance(led_anim_phase_t *phase) {
+    uint32_t elapsed = timer_elapsed32(phase->timer);
+
+    phase->timer += elapsed;
+    phase->phase += elapsed * phase->rate;
+    return phase->phase;
+}
+
+//Top byte picks the entry, the next one interpolates toward the following entry
+static int32_t curve(const int16_t *table, uint32_t phase) {
+    uint8_t index = phase >> 24;
+    int32_t a = (int16_t)pgm_read_word(table + index);
+    int32_t b = (int16_t)pgm_read_word(table + index + 1);
+
+    return a + (((b - a) * (int32_t)((phase >> 16) & 0xFF)) >> 8);
+}
+
+int16_t led_anim_sin(uint32_t phase) {
+    return curve(sine_curve, phase);
+}
+
+uint16_t led_anim_breathe(uint32_t phase) {
+#ifdef LED_ANIM_BREATHE_SINE
+    //Cosine starts at the top, so it is subtracted to start dark
+    return (PIXEL_LEVEL_MAX - ((led_anim_sin(phase + 0x40000000) * PIXEL_LEVEL_MAX) >> 15)) / 2;
+#else
+    return curve(breathe_curve, phase);
+#endif
+}
+
+void led_anim_set_breathing(bool breathing) {
+    if (breathing && !led_anim_breathing) {
+        led_anim_reset(&breathe);
+        gcr_breathe = gcr_desired;
+        gcr_wanted = gcr_desired;
+    }
+    led_anim_breathing = breathing;
+}
+
+void led_anim_frame(void) {
+    uint16_t level;
+
+    if (!led_anim_breathing) {
+        return;
+    }
+
+    level = led_anim_breathe(led_anim_advance(&breathe));
+    if (level < PIXEL_LEVEL_MAX) {
+        memcpy(frame.byte, led_buffer, PIXEL_FRAME_BYTES);
+        pixel_scale(&frame, level);
+        memcpy(led_buffer, frame.byte, PIXEL_FRAME_BYTES);
+    }
+}
+
+//Auto GCR (usb_gcr_auto) backs off while the 5V sags and steps back up once it recovers. Breathing dims the frame
+//for half of every breath, so it would climb back each time and sag again at the next peak. Like the core's own
+//breathing, the level it backs off to is kept in gcr_breathe and held as the ceiling until the brightness changes.
+void led_anim_limit_gcr(void) {
+    if (led_anim_breathing && usb_gcr_auto) {
+        if (gcr_desired != gcr_wanted) {
+            gcr_breathe = gcr_desired;
+            gcr_wanted = gcr_desired;
+        }
+        //Lowered by the auto GCR, not by following a lower gcr_desired down
+        if (gcr_actual < gcr_seen && gcr_actual < gcr_desired && gcr_actual < gcr_breathe) {
+            gcr_breathe = gcr_actual > LED_GCR_STEP ? gcr_actual : LED_GCR_STEP;
+        }
+        if (gcr_actual > gcr_breathe) {
+            gcr_actual = gcr_breathe;
+        }
+    }
+    gcr_seen = gcr_actual;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//Animation time as 32-bit phase accumulators advanced by elapsed timer ms, so an animation runs at the
+//same speed whatever the LED frame interval is. A full cycle is 2^32, curves come from flash tables.
+#ifndef LED_ANIM_BREATHE_MS
+#define LED_ANIM_BREATHE_MS         5100        //One breath, 510 of md_rgb_matrix.c's steps at the original 10 ms frames
+#endif
+//#define LED_ANIM_BREATHE_SINE                 //Breathe along a raised cosine instead of md_rgb_matrix.c's curve
+
+//Phase step per ms for a cycle of the given length
+#define LED_ANIM_RATE(ms)           ((uint32_t)((1ULL << 32) / (ms)))
+
+typedef struct {
+    uint32_t phase;
+    uint32_t rate;          //Phase added per ms, see LED_ANIM_RATE
+    uint32_t timer;         //timer_read32 the phase was last advanced to
+} led_anim_phase_t;
+
+extern bool led_anim_breathing;
+
+//Starts a phase over from zero
+void led_anim_reset(led_anim_phase_t *phase);
+//Adds the time since the last call and returns the new phase
+uint32_t led_anim_advance(led_anim_phase_t *phase);
+//Sine of a phase in Q15
+int16_t led_anim_sin(uint32_t phase);
+//Breathing level (0 - 256) at a phase, dark at zero
+uint16_t led_anim_breathe(uint32_t phase);
+
+//Turns breathing on or off, it starts from dark like md_rgb_matrix.c's
+void led_anim_set_breathing(bool breathing);
+//After the last LEDs of a frame are rendered, applies the breathing level to led_buffer
+void led_anim_frame(void);
+//Before a GCR write, holds gcr_actual under the ceiling auto GCR found while breathing
+void led_anim_limit_gcr(void);
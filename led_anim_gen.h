@@ -0,0 +1,47 @@
+// Generated by gen_led_anim.py, do not edit
+
+#pragma once
+
+#define LED_ANIM_LUT_SIZE 256
+
+//Breathing level (0-256) over one breath
+#define LED_ANIM_BREATHE { \
+         0,      0,      0,      0,      0,      0,      1,      1,      1,      1,      2,      2,      2,      3,      3,      3, \
+         4,      4,      5,      6,      6,      7,      7,      8,      9,     10,     10,     11,     12,     13,     14,     15, \
+        16,     17,     18,     19,     20,     21,     22,     23,     24,     26,     27,     28,     30,     31,     32,     34, \
+        35,     37,     38,     40,     41,     43,     44,     46,     48,     50,     51,     53,     55,     57,     59,     60, \
+        62,     64,     66,     68,     70,     73,     75,     77,     79,     81,     83,     86,     88,     90,     93,     95, \
+        98,    100,    102,    105,    108,    110,    113,    115,    118,    121,    123,    126,    129,    132,    135,    138, \
+       140,    143,    146,    149,    152,    155,    159,    162,    165,    168,    171,    174,    178,    181,    184,    188, \
+       191,    195,    198,    202,    205,    209,    212,    216,    219,    223,    227,    231,    234,    238,    242,    246, \
+       250,    246,    242,    238,    234,    231,    227,    223,    219,    216,    212,    209,    205,    202,    198,    195, \
+       191,    188,    184,    181,    178,    174,    171,    168,    165,    162,    159,    155,    152,    149,    146,    143, \
+       140,    138,    135,    132,    129,    126,    123,    121,    118,    115,    113,    110,    108,    105,    102,    100, \
+        98,     95,     93,     90,     88,     86,     83,     81,     79,     77,     75,     73,     70,     68,     66,     64, \
+        62,     60,     59,     57,     55,     53,     51,     50,     48,     46,     44,     43,     41,     40,     38,     37, \
+        35,     34,     32,     31,     30,     28,     27,     26,     24,     23,     22,     21,     20,     19,     18,     17, \
+        16,     15,     14,     13,     12,     11,     10,     10,      9,      8,      7,      7,      6,      6,      5,      4, \
+         4,      3,      3,      3,      2,      2,      2,      1,      1,      1,      1,      0,      0,      0,      0,      0, \
+         0, \
+}
+
+//Sine over one turn, Q15
+#define LED_ANIM_SINE { \
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793, \
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,  18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594, \
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956, \
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757, \
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,  32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571, \
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731, \
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279, \
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,   6393,   5602,   4808,   4011,   3212,   2410,   1608,    804, \
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793, \
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594, \
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, \
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757, \
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571, \
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, \
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279, \
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804, \
+         0, \
+}
@@ -0,0 +1,266 @@
+#include "led_flush.h"
+
+#include <string.h>
+#include "quantum.h"
+#include "arm_atsam_protocol.h"
+#include "config_led_gen.h"
+#include "frame_budget.h"
+#include "led_anim.h"
+#include "pixel.h"
+
+//Owned by md_rgb_matrix.c and i2c_master.c
+extern RGB led_buffer[ISSI3733_LED_COUNT];
+extern DmacDescriptor dmac_desc;
+
+//Linked in place of md_rgb_matrix.c's driver by -Wl,--wrap=rgb_matrix_driver (rules.mk), which still does the rest
+extern const rgb_matrix_driver_t __real_rgb_matrix_driver;
+
+led_flush_stats_t led_flush_stats;
+
+typedef struct {
+    uint8_t drv;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} led_flush_registers_t;
+
+static const led_flush_registers_t PROGMEM registers[ISSI3733_LED_COUNT] = LED_PWM_REGISTERS;
+
+//IS31FL3733 command register behind its write lock (datasheet table 2), the PWM registers are page 1
+static const uint8_t page_unlock[] = { 0xFE, 0xC5 };
+static const uint8_t page_pwm[] = { 0xFD, 0x01 };
+
+static pixel_frame_t last_frame;
+static pixel_frame_t frame;
+static uint8_t unchanged;
+static uint8_t idle_interval;
+
+//The newest frame and what the drivers hold, in register order
+static uint8_t wanted[ISSI3733_DRIVER_COUNT][LED_FLUSH_PAGE_BYTES];
+static uint8_t sent[ISSI3733_DRIVER_COUNT][LED_FLUSH_PAGE_BYTES];
+//Register address and values of the run on the bus, the DMA reads it until the write completes
+static uint8_t run[1 + LED_FLUSH_PAGE_BYTES];
+
+//A pass walks the drivers once, sending every run that differs, ISSI3733_DRIVER_COUNT while idle
+static uint8_t pass_drv = ISSI3733_DRIVER_COUNT;
+static uint8_t pass_reg;
+static uint8_t pass_selects;
+static bool pass_full;
+static bool pending;
+static uint32_t refresh_timer;
+
+static uint16_t changed_bytes(void) {
+    uint16_t count = 0;
+
+    for (uint8_t i = 0; i < PIXEL_FRAME_WORDS; i++) {
+        uint32_t diff = frame.word[i] ^ last_frame.word[i];
+
+        //Nearly every word is unchanged once an effect settles
+        for (; diff; diff >>= 8) {
+            count += (diff & 0xFF) != 0;
+        }
+    }
+    return count;
+}
+
+//Same transfer as the core's PWM page writes, its DMAC_0_Handler stops the bus and clears i2c_led_q_running
+static void send(uint8_t drv, const uint8_t *data, uint8_t length) {
+    i2c_led_q_running = 1;
+    dmac_desc.BTCNT.reg = length;
+    dmac_desc.SRCADDR.reg = (uint32_t)data + length;
+    SERCOM1->I2CM.ADDR.reg = (dmac_desc.BTCNT.reg << 16) | 0x2000 | issidrv[drv].addr;
+    DMAC->Channel[0].CHCTRLA.bit.ENABLE = 1;
+
+    led_flush_stats.writes++;
+    led_flush_stats.sent_bytes += 1 + length;
+}
+
+//Next registers from pass_reg on that differ from what the driver holds. A write costs a start, the driver
+//address and the register address, so short unchanged gaps are sent along rather than split around.
+static bool next_run(uint8_t *first, uint8_t *end) {
+    const uint8_t *want = wanted[pass_drv];
+    const uint8_t *have = sent[pass_drv];
+    uint16_t reg = pass_reg;
+    uint16_t last;
+
+    if (pass_full) {
+        *first = reg;
+        *end = LED_FLUSH_PAGE_BYTES;
+        return reg < LED_FLUSH_PAGE_BYTES;
+    }
+    while (reg < LED_FLUSH_PAGE_BYTES && want[reg] == have[reg]) {
+        reg++;
+    }
+    if (reg == LED_FLUSH_PAGE_BYTES) {
+        return false;
+    }
+    *first = reg;
+    for (last = reg++; reg < LED_FLUSH_PAGE_BYTES && reg - last <= LED_FLUSH_RUN_GAP + 1; reg++) {
+        if (want[reg] != have[reg]) {
+            last = reg;
+        }
+    }
+    *end = last + 1;
+    return true;
+}
+
+//Queues the LED on/off registers (page 0) of both drivers on the core's queue
+static void onoff_queue(void) {
+    for (uint8_t drv = 0; drv < ISSI3733_DRIVER_COUNT; drv++) {
+        I2C_LED_Q_ONOFF(drv);
+    }
+    i2c_led_q_run();
+}
+
+static bool pass_start(void) {
+    //Nothing else queues LED writes once this replaced the flush, so GCR changes go between passes
+    led_anim_limit_gcr();
+    if (gcr_actual != gcr_actual_last) {
+        for (uint8_t drv = 0; drv < ISSI3733_DRIVER_COUNT; drv++) {
+            I2C_LED_Q_GCR(drv);
+        }
+        gcr_actual_last = gcr_actual;
+        i2c_led_q_run();
+        return false;
+    }
+    if (!pending) {
+        return false;
+    }
+    pending = false;
+    pass_full = timer_elapsed32(refresh_timer) >= LED_FLUSH_REFRESH;
+    pass_drv = 0;
+    pass_reg = 0;
+    pass_selects = 0;
+    if (pass_full) {
+        refresh_timer = timer_read32();
+        led_flush_stats.refreshes++;
+        //A driver the core reset comes back with every LED switched off, the pass goes on once page 0 is written
+        onoff_queue();
+        return false;
+    }
+    return true;
+}
+
+void led_flush_task(void) {
+    uint8_t first, end;
+
+    //A write of ours or the core's GCR queue is on the bus
+    if (i2c_led_q_running || !i2c_led_q_isempty()) {
+        return;
+    }
+    if (pass_drv == ISSI3733_DRIVER_COUNT && !pass_start()) {
+        return;
+    }
+
+    for (; pass_drv < ISSI3733_DRIVER_COUNT; pass_drv++, pass_reg = 0, pass_selects = 0) {
+        if (!next_run(&first, &end)) {
+            continue;
+        }
+        //Only drivers with something to send get their page selected, once per pass
+        if (pass_selects < 2) {
+            send(pass_drv, pass_selects ? page_pwm : page_unlock, 2);
+            pass_selects++;
+            return;
+        }
+        run[0] = first;
+        memcpy(&run[1], &wanted[pass_drv][first], end - first);
+        memcpy(&sent[pass_drv][first], &run[1], end - first);
+        pass_reg = end;
+        send(pass_drv, run, 1 + end - first);
+        return;
+    }
+}
+
+void led_flush_wake(void) {
+    unchanged = 0;
+    if (idle_interval) {
+        idle_interval = 0;
+        frame_budget_idle(0);
+    }
+}
+
+static void flush(void) {
+    uint16_t dirty;
+
+#ifdef USE_MASSDROP_CONFIGURATOR
+    //Same as the core's flush, nothing is sent while the drivers are off
+    if (!led_enabled) {
+        return;
+    }
+#endif
+
+    memcpy(frame.byte, led_buffer, PIXEL_FRAME_BYTES);
+    dirty = changed_bytes();
+    last_frame = frame;
+
+    led_flush_stats.frames++;
+    led_flush_stats.dirty_bytes += dirty;
+
+    if (dirty || timer_elapsed32(refresh_timer) >= LED_FLUSH_REFRESH) {
+        for (uint8_t i = 0; i < ISSI3733_LED_COUNT; i++) {
+            uint8_t *want = wanted[pgm_read_byte(&registers[i].drv)];
+
+            want[pgm_read_byte(&registers[i].r)] = led_buffer[i].r;
+            want[pgm_read_byte(&registers[i].g)] = led_buffer[i].g;
+            want[pgm_read_byte(&registers[i].b)] = led_buffer[i].b;
+        }
+        pending = true;
+        led_flush_task();
+    }
+
+    //Frames repeat at the dark end of a breath, the ones after it will not
+    if (dirty || led_anim_breathing) {
+        led_flush_wake();
+        return;
+    }
+
+    led_flush_stats.idle_frames++;
+    if (unchanged < LED_FLUSH_IDLE_FRAMES) {
+        unchanged++;
+        return;
+    }
+
+    //Double the interval per unchanged frame, a static effect ends up flushed a few times per second
+    if (idle_interval < LED_FLUSH_IDLE_INTERVAL) {
+        idle_interval = idle_interval ? idle_interval * 2 : FRAME_BUDGET_INTERVAL_MIN * 2;
+        if (idle_interval > LED_FLUSH_IDLE_INTERVAL) {
+            idle_interval = LED_FLUSH_IDLE_INTERVAL;
+        }
+        frame_budget_idle(idle_interval);
+    }
+}
+
+static void init(void) {
+    __real_rgb_matrix_driver.init();
+    onoff_queue();
+    //Whatever the core's init left in the PWM registers is rewritten by the first pass
+    refresh_timer = timer_read32() - LED_FLUSH_REFRESH;
+}
+
+static void set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    __real_rgb_matrix_driver.set_color(index, r, g, b);
+}
+
+static void set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    __real_rgb_matrix_driver.set_color_all(r, g, b);
+}
+
+const rgb_matrix_driver_t __wrap_rgb_matrix_driver = {
+    .init = init,
+    .flush = flush,
+    .set_color = set_color,
+    .set_color_all = set_color_all,
+};
+
+void led_flush_print(void) {
+#ifdef CONSOLE_ENABLE
+    uint32_t frames = led_flush_stats.frames ? led_flush_stats.frames : 1;
+
+    uprintf("LED flush: %lu frames, %lu unchanged, %lu full refreshes\n", led_flush_stats.frames,
+        led_flush_stats.idle_frames, led_flush_stats.refreshes);
+    uprintf("  bytes/frame changed %lu sent %lu in %lu writes (full pages %u)\n", led_flush_stats.dirty_bytes / frames,
+        led_flush_stats.sent_bytes / frames, led_flush_stats.writes / frames,
+        ISSI3733_DRIVER_COUNT * (LED_FLUSH_PAGE_BYTES + 2));
+#endif
+    memset(&led_flush_stats, 0, sizeof(led_flush_stats));
+}
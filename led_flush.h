@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+//Replaces md_rgb_matrix.c's flush, which queues every PWM register of both drivers on every frame, with one
+//that writes only the register runs that changed. The frame is kept twice in register order: as rendered, and as
+//the drivers hold it once the write on the bus is done. Runs are copied out of the difference into a DMA buffer
+//and sent on the core's LED DMA channel one write at a time, started from the main loop whenever the bus is free,
+//so scanning goes on while a write is on the bus. Frames that change nothing also slow the frame rate down.
+#ifndef LED_FLUSH_IDLE_FRAMES
+#define LED_FLUSH_IDLE_FRAMES       4           //Unchanged frames before the frame interval starts stretching
+#endif
+#ifndef LED_FLUSH_IDLE_INTERVAL
+#define LED_FLUSH_IDLE_INTERVAL     100         //Longest frame interval (ms) while the frames are unchanged
+#endif
+#ifndef LED_FLUSH_RUN_GAP
+#define LED_FLUSH_RUN_GAP           2           //Unchanged registers a run is stretched over instead of starting another write
+#endif
+#ifndef LED_FLUSH_REFRESH
+#define LED_FLUSH_REFRESH           2000        //Every register is rewritten this often (ms), in case the core reset a driver
+#endif
+#define LED_FLUSH_PAGE_BYTES        192         //PWM registers per IS31FL3733
+
+typedef struct {
+    uint32_t frames;        //Frames flushed
+    uint32_t idle_frames;   //Frames identical to the one before
+    uint32_t dirty_bytes;   //Channel bytes that differed from the previous frame
+    uint32_t sent_bytes;    //Bytes started on the bus: address, register and PWM values of each write
+    uint32_t writes;        //I2C writes started, page selects included
+    uint32_t refreshes;     //Passes that rewrote every register
+} led_flush_stats_t;
+
+extern led_flush_stats_t led_flush_stats;
+
+//Every main loop pass, starts the next write when the bus is free
+void led_flush_task(void);
+//Something may change the next frame (a key event), go back to the full frame rate
+void led_flush_wake(void);
+//Prints the per-frame averages over the console and clears them
+void led_flush_print(void);
@@ -0,0 +1,125 @@
+#include "led_indicator.h"
+
+#include <string.h>
+#include "md_rgb_matrix.h"
+#include "config_led.h"
+#include "led_flush.h"
+
+extern RGB led_buffer[ISSI3733_LED_COUNT];
+
+#define OVERLAY_WORDS               ((DRIVER_LED_TOTAL + 31) / 32)
+
+led_indicator_stats_t led_indicator_stats;
+
+static led_t locks;
+static layer_state_t layers;
+
+//One bit per LED the overlay covers, and the colour each of them is drawn in
+static uint32_t overlay[OVERLAY_WORDS];
+static RGB overlay_color[DRIVER_LED_TOTAL];
+
+static void overlay_set(uint8_t scan, uint8_t r, uint8_t g, uint8_t b) {
+    uint8_t led;
+
+    if (scan >= MATRIX_ROWS * MATRIX_COLS) {
+        return;
+    }
+    led = g_led_config.matrix_co[scan / MATRIX_COLS][scan % MATRIX_COLS];
+    if (led >= DRIVER_LED_TOTAL) {
+        return;
+    }
+    overlay[led / 32] |= 1UL << (led % 32);
+    overlay_color[led] = (RGB){ .r = r, .g = g, .b = b };
+}
+
+//Locks go last so they win over a layer indicator on the same key, as they did drawn over the frame
+static void overlay_compose(void) {
+    memset(overlay, 0, sizeof(overlay));
+
+    if (led_layer_indicators) {
+        for (const led_layer_indicator_t *ind = led_layer_indicators; !ind->end; ind++) {
+            if (layers & ((layer_state_t)1 << ind->layer)) {
+                overlay_set(ind->scan, ind->r, ind->g, ind->b);
+            }
+        }
+    }
+
+#ifdef USB_LED_INDICATOR_ENABLE
+#if USB_LED_NUM_LOCK_SCANCODE != 255
+    if (locks.num_lock) {
+        overlay_set(USB_LED_NUM_LOCK_SCANCODE, LED_INDICATOR_R, LED_INDICATOR_G, LED_INDICATOR_B);
+    }
+#endif
+#if USB_LED_CAPS_LOCK_SCANCODE != 255
+    if (locks.caps_lock) {
+        overlay_set(USB_LED_CAPS_LOCK_SCANCODE, LED_INDICATOR_R, LED_INDICATOR_G, LED_INDICATOR_B);
+    }
+#endif
+#if USB_LED_SCROLL_LOCK_SCANCODE != 255
+    if (locks.scroll_lock) {
+        overlay_set(USB_LED_SCROLL_LOCK_SCANCODE, LED_INDICATOR_R, LED_INDICATOR_G, LED_INDICATOR_B);
+    }
+#endif
+#if USB_LED_COMPOSE_SCANCODE != 255
+    if (locks.compose) {
+        overlay_set(USB_LED_COMPOSE_SCANCODE, LED_INDICATOR_R, LED_INDICATOR_G, LED_INDICATOR_B);
+    }
+#endif
+#if USB_LED_KANA_SCANCODE != 255
+    if (locks.kana) {
+        overlay_set(USB_LED_KANA_SCANCODE, LED_INDICATOR_R, LED_INDICATOR_G, LED_INDICATOR_B);
+    }
+#endif
+#endif //USB_LED_INDICATOR_ENABLE
+
+    led_indicator_stats.lit = 0;
+    for (uint8_t w = 0; w < OVERLAY_WORDS; w++) {
+        led_indicator_stats.lit += __builtin_popcount(overlay[w]);
+    }
+    led_indicator_stats.updates++;
+
+    //The next frames differ even while nothing else moves
+    led_flush_wake();
+}
+
+void led_indicator_locks(led_t state) {
+    if (state.raw == locks.raw) {
+        return;
+    }
+    locks = state;
+    overlay_compose();
+}
+
+void led_indicator_layers(layer_state_t state) {
+    if (state == layers) {
+        return;
+    }
+    layers = state;
+    overlay_compose();
+}
+
+void led_indicator_frame(void) {
+    if (!led_indicator_stats.lit) {
+        return;
+    }
+    for (uint8_t w = 0; w < OVERLAY_WORDS; w++) {
+        uint32_t bits = overlay[w];
+
+        while (bits) {
+            uint8_t led = w * 32 + __builtin_ctz(bits);
+
+            led_buffer[led] = overlay_color[led];
+            bits &= bits - 1;
+        }
+    }
+    led_indicator_stats.frames++;
+}
+
+void led_indicator_print(void) {
+#ifdef CONSOLE_ENABLE
+    uprintf("Indicators:\n");
+    uprintf("  updates %lu frames %lu lit %u\n", led_indicator_stats.updates, led_indicator_stats.frames, led_indicator_stats.lit);
+#endif
+    led_indicator_stats.updates = 0;
+    led_indicator_stats.frames = 0;
+}
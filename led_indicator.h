@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+//Lock and layer indicators, composed into a cached overlay when the host's LED report or the layer
+//state changes. A frame only copies the overlay's LEDs, and nothing at all while none are lit.
+#ifndef LED_INDICATOR_R
+#define LED_INDICATOR_R             255         //Colour of the USB_LED_*_SCANCODE keys while their lock is on
+#endif
+#ifndef LED_INDICATOR_G
+#define LED_INDICATOR_G             255
+#endif
+#ifndef LED_INDICATOR_B
+#define LED_INDICATOR_B             255
+#endif
+
+//A key lit while a layer is on, from the keymap's led_layer_indicators[]
+typedef struct {
+    uint8_t layer;
+    uint8_t scan;           //Key matrix code, like USB_LED_*_SCANCODE
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t end;            //Set on the entry after the last one
+} led_layer_indicator_t;
+
+typedef struct {
+    uint32_t updates;       //Overlays composed
+    uint32_t frames;        //Frames the overlay was drawn on
+    uint8_t lit;            //LEDs in the current overlay
+} led_indicator_stats_t;
+
+extern led_indicator_stats_t led_indicator_stats;
+
+//Optional, defined by the keymap and ended by { .end = 1 }
+extern const led_layer_indicator_t led_layer_indicators[] __attribute__((weak));
+
+//The host's lock LEDs changed
+void led_indicator_locks(led_t state);
+//The layer state changed, default layers included
+void led_indicator_layers(layer_state_t state);
+//After breathing and before the power limit, draws the overlay into led_buffer
+void led_indicator_frame(void);
+//Prints the overlay counts over the console and clears them
+void led_indicator_print(void);
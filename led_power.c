@@ -0,0 +1,48 @@
+#include "led_power.h"
+
+#include <string.h>
+#include "quantum.h"
+#include "md_rgb_matrix.h"
+
+extern RGB led_buffer[ISSI3733_LED_COUNT];
+
+led_power_stats_t led_power_stats;
+bool led_power_limit = true;
+
+static pixel_frame_t frame;
+
+void led_power_frame(void) {
+    uint32_t estimate;
+    uint16_t level;
+
+    if (!led_power_limit) {
+        return;
+    }
+
+    memcpy(frame.byte, led_buffer, PIXEL_FRAME_BYTES);
+    //gcr_actual only ramps toward gcr_desired, so budget for where it ends up
+    estimate = led_power_estimate(&frame, gcr_desired);
+
+    led_power_stats.frames++;
+    led_power_stats.total_ma += estimate / 1000;
+    if (estimate / 1000 > led_power_stats.max_ma) {
+        led_power_stats.max_ma = estimate / 1000;
+    }
+
+    level = led_power_level(estimate, LED_POWER_BUDGET_MA * 1000UL);
+    if (level < PIXEL_LEVEL_MAX) {
+        pixel_scale(&frame, level);
+        memcpy(led_buffer, frame.byte, PIXEL_FRAME_BYTES);
+        led_power_stats.limited++;
+    }
+}
+
+void led_power_print(void) {
+#ifdef CONSOLE_ENABLE
+    uint32_t avg_ma = led_power_stats.frames ? (uint32_t)(led_power_stats.total_ma / led_power_stats.frames) : 0;
+
+    uprintf("LED current: avg %lu mA max %lu mA, budget %u mA\n", avg_ma, led_power_stats.max_ma, LED_POWER_BUDGET_MA);
+    uprintf("  frames %lu limited %lu\n", led_power_stats.frames, led_power_stats.limited);
+#endif
+    memset(&led_power_stats, 0, sizeof(led_power_stats));
+}
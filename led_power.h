@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pixel.h"
+#include "led_power_model.h"
+
+//Predictive LED current limit: each rendered frame's current is estimated from its PWM values
+//and the frame is scaled down before it is flushed if it would exceed the budget
+#ifndef LED_POWER_BUDGET_MA
+#define LED_POWER_BUDGET_MA         400         //LED current allowed from the host port, leaving the rest of 500 mA to the MCU and hub
+#endif
+
+typedef struct {
+    uint32_t frames;        //Frames estimated
+    uint32_t limited;       //Frames scaled down to the budget
+    uint32_t max_ma;        //Highest estimate before scaling
+    uint64_t total_ma;      //Sum of the estimates before scaling
+} led_power_stats_t;
+
+extern led_power_stats_t led_power_stats;
+extern bool led_power_limit;
+
+//After the last LEDs of a frame are rendered, scales led_buffer down to the budget
+void led_power_frame(void);
+//Prints the estimates over the console and clears them
+void led_power_print(void);
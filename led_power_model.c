@@ -0,0 +1,62 @@
+#include "led_power_model.h"
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP == 1
+#include "samd51j18a.h"     //CMSIS intrinsics
+#define LED_POWER_DSP
+#endif
+
+uint32_t led_power_weighted_sum_scalar(const pixel_frame_t *frame, uint8_t r, uint8_t g, uint8_t b) {
+    const uint8_t weight[3] = { r, g, b };
+    uint32_t sum = 0;
+
+    for (uint16_t i = 0; i < sizeof(frame->byte); i++) {
+        sum += frame->byte[i] * weight[i % 3];
+    }
+    return sum;
+}
+
+#ifdef LED_POWER_DSP
+
+//Channels repeat every three words, so each word is matched with one of three weight words
+//and SMLAD multiplies and accumulates two channel/weight halfword pairs at a time
+uint32_t led_power_weighted_sum(const pixel_frame_t *frame, uint8_t r, uint8_t g, uint8_t b) {
+    const uint32_t weights[3] = {
+        r | g << 8 | b << 16 | (uint32_t)r << 24,
+        g | b << 8 | r << 16 | (uint32_t)g << 24,
+        b | r << 8 | g << 16 | (uint32_t)b << 24,
+    };
+    uint32_t sum = 0;
+    uint8_t phase = 0;
+
+    for (uint8_t i = 0; i < PIXEL_FRAME_WORDS; i++) {
+        uint32_t x = frame->word[i];
+        uint32_t w = weights[phase];
+
+        sum = __SMLAD(__UXTB16(x), __UXTB16(w), sum);
+        sum = __SMLAD(__UXTB16(__ROR(x, 8)), __UXTB16(__ROR(w, 8)), sum);
+        phase = phase == 2 ? 0 : phase + 1;
+    }
+    return sum;
+}
+
+#else
+
+uint32_t led_power_weighted_sum(const pixel_frame_t *frame, uint8_t r, uint8_t g, uint8_t b) {
+    return led_power_weighted_sum_scalar(frame, r, g, b);
+}
+
+#endif //LED_POWER_DSP
+
+uint32_t led_power_estimate(const pixel_frame_t *frame, uint8_t gcr) {
+    uint32_t weighted = led_power_weighted_sum(frame, LED_POWER_WEIGHT_R, LED_POWER_WEIGHT_G, LED_POWER_WEIGHT_B);
+
+    return (uint64_t)weighted * LED_POWER_CHANNEL_UA * gcr / (255UL * 255 * 255);
+}
+
+//Rounded down, and pixel_scale rounds every channel down, so the scaled frame never exceeds the budget
+uint16_t led_power_level(uint32_t estimate_ua, uint32_t budget_ua) {
+    if (estimate_ua <= budget_ua) {
+        return PIXEL_LEVEL_MAX;
+    }
+    return (uint64_t)budget_ua * PIXEL_LEVEL_MAX / estimate_ua;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+#include "pixel.h"
+
+//Current model of the predictive LED limit (led_power.c). Plain C on a pixel frame, nothing from QMK or the
+//board, so it runs on synthetic frames off the device (tests/led_power)
+#ifndef LED_POWER_CHANNEL_UA
+#define LED_POWER_CHANNEL_UA        3500        //Average current of one channel at full PWM and GCR (42 mA peak over the 12 row scan)
+#endif
+//Relative draw of each channel (0 - 255), the IS31FL3733 sinks the same current for all of them
+#ifndef LED_POWER_WEIGHT_R
+#define LED_POWER_WEIGHT_R          255
+#endif
+#ifndef LED_POWER_WEIGHT_G
+#define LED_POWER_WEIGHT_G          255
+#endif
+#ifndef LED_POWER_WEIGHT_B
+#define LED_POWER_WEIGHT_B          255
+#endif
+
+//Sum of every channel byte times the weight (0 - 255) of its channel
+uint32_t led_power_weighted_sum(const pixel_frame_t *frame, uint8_t r, uint8_t g, uint8_t b);
+//Portable version, used when the core has no DSP extension and to check the kernel against
+uint32_t led_power_weighted_sum_scalar(const pixel_frame_t *frame, uint8_t r, uint8_t g, uint8_t b);
+
+//Estimated LED current (uA) of a frame at the given GCR
+uint32_t led_power_estimate(const pixel_frame_t *frame, uint8_t gcr);
+//Level (0 - 256) for pixel_scale that brings an estimate within the budget, PIXEL_LEVEL_MAX if it already fits
+uint16_t led_power_level(uint32_t estimate_ua, uint32_t budget_ua);
@@ -0,0 +1,224 @@
+/*
+Matrix scan reading each port once per row
+
+The column pins are grouped at init into runs of consecutive bits on the same port (B04-B13, A05-A07
+and A10-A11 on this board), so a row is read with one IN register access per port and a shift/mask per
+run. After a row is released only the columns that were pulled low are waited on.
+
+Rows start out read after QMK's default matrix_io_delay. Whenever a row is selected with keys already
+known to be down, the time until their columns go low is taken, and once enough of those real column
+transitions have been seen the select delay drops to twice the slowest of them plus a margin. The row
+pin's own readback says nothing about the columns, so it is not used.
+
+While idle_power.c has stepped the scan rate down and no key is down, the loops in between select every
+row at once and read the columns in one go. Any key going down changes that reading, and the full scan
+runs right away. With a key held the combined reading cannot show a second key in the same column (or
+the release of one of two), so every loop scans in full until all keys are up again.
+*/
+
+#include "quantum.h"
+#include "matrix.h"
+#include "samd51j18a.h"
+#include "dwt.h"
+#include "idle_power.h"
+#include "matrix_scan.h"
+#ifdef SOF_SYNC_ENABLE
+#include "sof_sync.h"
+#endif
+
+#define PORT_GROUPS                 2           //PA and PB
+#define PIN_GROUP(pin)              ((pin) >> 5)
+#define PIN_INDEX(pin)              ((pin) & 0x1F)
+
+//Added on top of twice the slowest column transition seen, for temperature drift
+#ifndef MATRIX_SELECT_MARGIN
+#define MATRIX_SELECT_MARGIN        (DWT_CYCLES_PER_US / 4)
+#endif
+#define MATRIX_SELECT_FLOOR         (DWT_CYCLES_PER_US * MATRIX_SELECT_FLOOR_US)
+//Upper bound for waiting on columns to recover after a row is released
+#define MATRIX_UNSELECT_MAX         (DWT_CYCLES_PER_US * 30)
+
+typedef struct {
+    uint8_t group;
+    uint8_t shift;
+    uint8_t col;
+    uint32_t mask;
+} col_run_t;
+
+static const uint8_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const uint8_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+static col_run_t col_runs[MATRIX_COLS];
+static uint8_t col_run_count;
+static uint32_t col_mask[PORT_GROUPS];
+static uint32_t row_mask[PORT_GROUPS];
+//Columns with any key down as of the last full scan, the all-rows probe only stands in while this is empty
+static matrix_row_t cols_down;
+
+matrix_scan_stats_t matrix_scan_stats;
+uint32_t matrix_select_delay = MATRIX_SELECT_FLOOR;
+
+static void build_col_runs(void) {
+    col_run_t *run = NULL;
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        uint8_t group = PIN_GROUP(col_pins[col]);
+        uint8_t index = PIN_INDEX(col_pins[col]);
+
+        col_mask[group] |= 1UL << index;
+        if (run && run->group == group && run->shift + (col - run->col) == index) {
+            run->mask = (run->mask << 1) | 1;
+            continue;
+        }
+        run = &col_runs[col_run_count++];
+        run->group = group;
+        run->shift = index;
+        run->col = col;
+        run->mask = 1;
+    }
+}
+
+//Columns pulled low, from one IN read per port
+static matrix_row_t read_cols(void) {
+    uint32_t in[PORT_GROUPS];
+    matrix_row_t cols = 0;
+
+    for (uint8_t port = 0; port < PORT_GROUPS; port++) {
+        in[port] = PORT->Group[port].IN.reg;
+    }
+    for (uint8_t i = 0; i < col_run_count; i++) {
+        const col_run_t *run = &col_runs[i];
+
+        cols |= (matrix_row_t)(((~in[run->group]) >> run->shift) & run->mask) << run->col;
+    }
+    return cols;
+}
+
+//A key known to be down pulled its column low this many cycles after the row was selected
+static void select_sample(uint32_t cycles) {
+    matrix_scan_stats.samples++;
+    if (cycles > matrix_scan_stats.slowest) {
+        matrix_scan_stats.slowest = cycles;
+    }
+    if (matrix_scan_stats.samples >= MATRIX_SELECT_SAMPLES) {
+        uint32_t delay = 2 * matrix_scan_stats.slowest + MATRIX_SELECT_MARGIN;
+
+        matrix_select_delay = delay < MATRIX_SELECT_FLOOR ? delay : MATRIX_SELECT_FLOOR;
+    }
+}
+
+void matrix_init_custom(void) {
+    dwt_init();
+    build_col_runs();
+
+    //Columns: inputs pulled up, continuously sampled so IN reflects the pin without synchronizer delay
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        PortGroup *group = &PORT->Group[PIN_GROUP(col_pins[col])];
+        uint8_t index = PIN_INDEX(col_pins[col]);
+
+        group->DIRCLR.reg = 1UL << index;
+        group->OUTSET.reg = 1UL << index;
+        group->PINCFG[index].reg = PORT_PINCFG_INEN | PORT_PINCFG_PULLEN;
+        group->CTRL.reg |= 1UL << index;
+    }
+
+    //Rows: outputs idling high
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        PortGroup *group = &PORT->Group[PIN_GROUP(row_pins[row])];
+        uint8_t index = PIN_INDEX(row_pins[row]);
+
+        group->OUTSET.reg = 1UL << index;
+        group->DIRSET.reg = 1UL << index;
+        row_mask[PIN_GROUP(row_pins[row])] |= 1UL << index;
+    }
+}
+
+//Selects the rows in the given masks together and returns the columns they pull low
+//Columns in expect (keys down as of the last scan) are timed going low, up to the floor: a key released since
+//then costs one wait of the floor, a slow column raises the delay before it can be missed
+static matrix_row_t read_rows(const uint32_t select[PORT_GROUPS], matrix_row_t expect) {
+    matrix_row_t cols;
+    uint32_t start;
+
+    for (uint8_t port = 0; port < PORT_GROUPS; port++) {
+        PORT->Group[port].OUTCLR.reg = select[port];
+    }
+    start = dwt_cycles();
+    if (expect) {
+        matrix_row_t low;
+        uint32_t elapsed;
+
+        do {
+            low = read_cols() & expect;
+            elapsed = dwt_cycles() - start;
+        } while (low != expect && elapsed < MATRIX_SELECT_FLOOR);
+        if (low == expect) {
+            select_sample(elapsed);
+        }
+    }
+    while (dwt_cycles() - start < matrix_select_delay) {}
+    cols = read_cols();
+    for (uint8_t port = 0; port < PORT_GROUPS; port++) {
+        PORT->Group[port].OUTSET.reg = select[port];
+    }
+
+    //Columns pulled low by this row must be back high before the next row is selected
+    if (cols) {
+        uint32_t released = dwt_cycles();
+
+        for (uint8_t port = 0; port < PORT_GROUPS; port++) {
+            while ((PORT->Group[port].IN.reg & col_mask[port]) != col_mask[port] && dwt_cycles() - released < MATRIX_UNSELECT_MAX) {}
+        }
+    }
+    return cols;
+}
+
+static matrix_row_t read_row(uint8_t row, matrix_row_t expect) {
+    uint32_t select[PORT_GROUPS] = { 0 };
+
+    select[PIN_GROUP(row_pins[row])] = 1UL << PIN_INDEX(row_pins[row]);
+    return read_rows(select, expect);
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    bool changed = false;
+    matrix_row_t down = 0;
+
+    if (!cols_down && !idle_power_scan_due()) {
+        bool probe_changed = read_rows(row_mask, 0) != 0;
+
+        idle_power_probed(probe_changed);
+        if (!probe_changed) {
+            return false;
+        }
+    }
+
+#ifdef SOF_SYNC_ENABLE
+    sof_sync_scan();
+#endif
+    matrix_scan_stats.scans++;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t cols = read_row(row, current_matrix[row]);
+
+        if (current_matrix[row] != cols) {
+            current_matrix[row] = cols;
+            changed = true;
+        }
+        down |= cols;
+    }
+    cols_down = down;
+    if (changed) {
+        idle_power_activity();
+    }
+    return changed;
+}
+
+void matrix_scan_print(void) {
+#ifdef CONSOLE_ENABLE
+    uprintf("Matrix: select delay %lu cycles (%s), %lu column transitions timed, slowest %lu cycles\n",
+        matrix_select_delay, matrix_scan_stats.samples >= MATRIX_SELECT_SAMPLES ? "calibrated" : "floor",
+        matrix_scan_stats.samples, matrix_scan_stats.slowest);
+    uprintf("  full scans %lu\n", matrix_scan_stats.scans);
+#endif
+    matrix_scan_stats.scans = 0;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+//Row select delay of the port-wide matrix scan (matrix.c)
+//Rows are read after the QMK default matrix_io_delay until enough real column transitions (a key already known
+//to be down pulling its column low) have been timed, then after twice the slowest of them plus a margin
+#ifndef MATRIX_SELECT_FLOOR_US
+#define MATRIX_SELECT_FLOOR_US      30          //Select delay until calibrated, and the most it ever gets
+#endif
+#ifndef MATRIX_SELECT_SAMPLES
+#define MATRIX_SELECT_SAMPLES       32          //Column transitions timed before the delay drops below the floor
+#endif
+
+typedef struct {
+    uint32_t scans;         //Full scans
+    uint32_t samples;       //Column transitions timed, kept across prints
+    uint32_t slowest;       //Slowest of them (cycles), kept across prints
+} matrix_scan_stats_t;
+
+extern matrix_scan_stats_t matrix_scan_stats;
+//Cycles from selecting a row until its columns are read
+extern uint32_t matrix_select_delay;
+
+//Prints the select delay and the calibration over the console and clears the scan count
+void matrix_scan_print(void);
@@ -0,0 +1,177 @@
+#include "pixel.h"
+
+#include <string.h>
+#ifdef PIXEL_BENCH
+#include "quantum.h"
+#include "dwt.h"
+#include "led_power_model.h"
+#endif
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP == 1
+#include "samd51j18a.h"     //CMSIS intrinsics
+#define PIXEL_DSP
+#endif
+
+void pixel_add_scalar(pixel_frame_t *dst, const pixel_frame_t *src) {
+    for (uint16_t i = 0; i < sizeof(dst->byte); i++) {
+        uint16_t sum = dst->byte[i] + src->byte[i];
+
+        dst->byte[i] = sum > 255 ? 255 : sum;
+    }
+}
+
+void pixel_average_scalar(pixel_frame_t *dst, const pixel_frame_t *src) {
+    for (uint16_t i = 0; i < sizeof(dst->byte); i++) {
+        dst->byte[i] = (dst->byte[i] + src->byte[i]) >> 1;
+    }
+}
+
+void pixel_blend_scalar(pixel_frame_t *dst, const pixel_frame_t *src, uint16_t alpha) {
+    for (uint16_t i = 0; i < sizeof(dst->byte); i++) {
+        dst->byte[i] = (dst->byte[i] * (PIXEL_LEVEL_MAX - alpha) + src->byte[i] * alpha) >> 8;
+    }
+}
+
+void pixel_scale_scalar(pixel_frame_t *frame, uint16_t level) {
+    for (uint16_t i = 0; i < sizeof(frame->byte); i++) {
+        frame->byte[i] = (frame->byte[i] * level) >> 8;
+    }
+}
+
+uint32_t pixel_sum_scalar(const pixel_frame_t *frame) {
+    uint32_t sum = 0;
+
+    for (uint16_t i = 0; i < sizeof(frame->byte); i++) {
+        sum += frame->byte[i];
+    }
+    return sum;
+}
+
+#ifdef PIXEL_DSP
+
+//UXTB16 splits a word into its even and odd bytes as two halfword lanes. A byte
+//times a level of at most 256 still fits its lane, so one MUL scales two channels.
+
+void pixel_add(pixel_frame_t *dst, const pixel_frame_t *src) {
+    for (uint8_t i = 0; i < PIXEL_FRAME_WORDS; i++) {
+        dst->word[i] = __UQADD8(dst->word[i], src->word[i]);
+    }
+}
+
+void pixel_average(pixel_frame_t *dst, const pixel_frame_t *src) {
+    for (uint8_t i = 0; i < PIXEL_FRAME_WORDS; i++) {
+        dst->word[i] = __UHADD8(dst->word[i], src->word[i]);
+    }
+}
+
+void pixel_blend(pixel_frame_t *dst, const pixel_frame_t *src, uint16_t alpha) {
+    uint32_t keep = PIXEL_LEVEL_MAX - alpha;
+
+    for (uint8_t i = 0; i < PIXEL_FRAME_WORDS; i++) {
+        uint32_t d = dst->word[i];
+        uint32_t s = src->word[i];
+        uint32_t even = (__UXTB16(d) * keep + __UXTB16(s) * alpha) >> 8;
+        uint32_t odd = __UXTB16(__ROR(d, 8)) * keep + __UXTB16(__ROR(s, 8)) * alpha;
+
+        dst->word[i] = (even & 0x00FF00FF) | (odd & 0xFF00FF00);
+    }
+}
+
+void pixel_scale(pixel_frame_t *frame, uint16_t level) {
+    for (uint8_t i = 0; i < PIXEL_FRAME_WORDS; i++) {
+        uint32_t x = frame->word[i];
+        uint32_t even = (__UXTB16(x) * level) >> 8;
+        uint32_t odd = __UXTB16(__ROR(x, 8)) * level;
+
+        frame->word[i] = (even & 0x00FF00FF) | (odd & 0xFF00FF00);
+    }
+}
+
+uint32_t pixel_sum(const pixel_frame_t *frame) {
+    uint32_t sum = 0;
+
+    for (uint8_t i = 0; i < PIXEL_FRAME_WORDS; i++) {
+        sum = __USADA8(frame->word[i], 0, sum);
+    }
+    return sum;
+}
+
+#else
+
+void pixel_add(pixel_frame_t *dst, const pixel_frame_t *src) {
+    pixel_add_scalar(dst, src);
+}
+
+void pixel_average(pixel_frame_t *dst, const pixel_frame_t *src) {
+    pixel_average_scalar(dst, src);
+}
+
+void pixel_blend(pixel_frame_t *dst, const pixel_frame_t *src, uint16_t alpha) {
+    pixel_blend_scalar(dst, src, alpha);
+}
+
+void pixel_scale(pixel_frame_t *frame, uint16_t level) {
+    pixel_scale_scalar(frame, level);
+}
+
+uint32_t pixel_sum(const pixel_frame_t *frame) {
+    return pixel_sum_scalar(frame);
+}
+
+#endif //PIXEL_DSP
+
+#ifdef PIXEL_BENCH
+static pixel_frame_t bench_src;
+static pixel_frame_t bench_kernel;
+static pixel_frame_t bench_scalar;
+
+static void bench_fill(pixel_frame_t *frame, uint32_t seed) {
+    memset(frame, 0, sizeof(*frame));
+    for (uint16_t i = 0; i < PIXEL_FRAME_BYTES; i++) {
+        seed = seed * 1664525 + 1013904223;
+        frame->byte[i] = seed >> 24;
+    }
+}
+
+#define BENCH_TIME(cycles, call) { \
+        uint32_t start = dwt_cycles(); \
+        call; \
+        cycles = dwt_cycles() - start; \
+    }
+
+#define BENCH_FRAMES(name, kernel, scalar) { \
+        uint32_t kernel_cycles, scalar_cycles; \
+        bench_fill(&bench_kernel, 1); \
+        bench_scalar = bench_kernel; \
+        BENCH_TIME(kernel_cycles, kernel); \
+        BENCH_TIME(scalar_cycles, scalar); \
+        uprintf("  %-8s %5lu %5lu %s\n", name, kernel_cycles, scalar_cycles, \
+            memcmp(&bench_kernel, &bench_scalar, sizeof(bench_kernel)) ? "MISMATCH" : "ok"); \
+    }
+
+void pixel_bench(void) {
+#ifdef CONSOLE_ENABLE
+    uint32_t kernel_sum, scalar_sum, kernel_cycles, scalar_cycles;
+
+    bench_fill(&bench_src, 2);
+
+#ifdef PIXEL_DSP
+    uprintf("Pixel kernels (cycles per frame, DSP vs scalar):\n");
+#else
+    uprintf("Pixel kernels (cycles per frame, no DSP extension):\n");
+#endif
+    BENCH_FRAMES("add", pixel_add(&bench_kernel, &bench_src), pixel_add_scalar(&bench_scalar, &bench_src));
+    BENCH_FRAMES("average", pixel_average(&bench_kernel, &bench_src), pixel_average_scalar(&bench_scalar, &bench_src));
+    BENCH_FRAMES("blend", pixel_blend(&bench_kernel, &bench_src, 77), pixel_blend_scalar(&bench_scalar, &bench_src, 77));
+    BENCH_FRAMES("scale", pixel_scale(&bench_kernel, 200), pixel_scale_scalar(&bench_scalar, 200));
+
+    BENCH_TIME(kernel_cycles, kernel_sum = pixel_sum(&bench_src));
+    BENCH_TIME(scalar_cycles, scalar_sum = pixel_sum_scalar(&bench_src));
+    uprintf("  %-8s %5lu %5lu %s\n", "sum", kernel_cycles, scalar_cycles, kernel_sum == scalar_sum ? "ok" : "MISMATCH");
+
+    BENCH_TIME(kernel_cycles, kernel_sum = led_power_weighted_sum(&bench_src, 255, 180, 90));
+    BENCH_TIME(scalar_cycles, scalar_sum = led_power_weighted_sum_scalar(&bench_src, 255, 180, 90));
+    uprintf("  %-8s %5lu %5lu %s\n", "weighted", kernel_cycles, scalar_cycles, kernel_sum == scalar_sum ? "ok" : "MISMATCH");
+#endif
+}
+#endif //PIXEL_BENCH
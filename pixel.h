@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config_led.h"
+
+//Packed RGB frame: r, g, b bytes per LED back to back, padded with zeros to whole words
+//Kernels work on four channel bytes per word regardless of which LED or channel they belong to
+#define PIXEL_FRAME_BYTES           (ISSI3733_LED_COUNT * 3)
+#define PIXEL_FRAME_WORDS           ((PIXEL_FRAME_BYTES + 3) / 4)
+#define PIXEL_LEVEL_MAX             256         //Full scale for alpha and level arguments
+
+typedef union {
+    uint32_t word[PIXEL_FRAME_WORDS];
+    uint8_t byte[PIXEL_FRAME_WORDS * 4];
+} pixel_frame_t;
+
+static inline void pixel_set(pixel_frame_t *frame, uint8_t led, uint8_t r, uint8_t g, uint8_t b) {
+    uint8_t *pixel = &frame->byte[led * 3];
+
+    pixel[0] = r;
+    pixel[1] = g;
+    pixel[2] = b;
+}
+
+//dst = saturate(dst + src)
+void pixel_add(pixel_frame_t *dst, const pixel_frame_t *src);
+//dst = (dst + src) / 2, rounded down
+void pixel_average(pixel_frame_t *dst, const pixel_frame_t *src);
+//dst = (dst * (256 - alpha) + src * alpha) / 256, alpha 0 - 256
+void pixel_blend(pixel_frame_t *dst, const pixel_frame_t *src, uint16_t alpha);
+//frame = frame * level / 256, level 0 - 256
+void pixel_scale(pixel_frame_t *frame, uint16_t level);
+//Sum of every channel byte, the frame's total brightness
+uint32_t pixel_sum(const pixel_frame_t *frame);
+
+//Portable versions, used when the core has no DSP extension and to check the kernels against
+void pixel_add_scalar(pixel_frame_t *dst, const pixel_frame_t *src);
+void pixel_average_scalar(pixel_frame_t *dst, const pixel_frame_t *src);
+void pixel_blend_scalar(pixel_frame_t *dst, const pixel_frame_t *src, uint16_t alpha);
+void pixel_scale_scalar(pixel_frame_t *frame, uint16_t level);
+uint32_t pixel_sum_scalar(const pixel_frame_t *frame);
+
+#ifdef PIXEL_BENCH
+//Times each kernel against its portable version on a test frame, prints the cycles and whether they agree
+void pixel_bench(void);
+#endif
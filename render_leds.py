@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+"""Render the Massdrop LED pipeline offline and report the work per frame.
+
+Mirrors the USE_MASSDROP_CONFIGURATOR path of md_rgb_matrix.c: every LED
+walks led_instruction_set[] from the keymap, fixed colours and patterns from
+led_matrix_programs.c in the QMK checkout are applied at the LED's position,
+scrolling follows led_animation_speed and breathing scales the finished
+frame by led_anim.c's curve at the frame's time. The layout comes from
+config_led_gen.h and the breathing curve from led_anim_gen.h.
+
+For every led_animation_id and led_lighting_mode, N frames are written as
+PPM images under the output directory, and the instructions and pattern
+segments evaluated per frame are reported.
+
+This is a Python model of md_rgb_matrix.c, not the C code itself, and it
+does not measure cycles. The counts are what the frame cost scales with,
+and they are good for comparing effects with each other. The cycles per
+frame against the scan budget come from the board: DBG_PRF with LED_BENCH
+defined. Anything this model gets wrong about md_rgb_matrix.c shows up in
+the images, not in the counts.
+
+Run from the keyboard directory:
+    ./render_leds.py [--keymap mbednarek360] [--qmk ~/qmk_firmware] [--frames 100] [--out led_render]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+LAYOUT = os.path.join(HERE, "config_led_gen.h")
+CURVES = os.path.join(HERE, "led_anim_gen.h")
+PROGRAMS = "tmk_core/protocol/arm_atsam/led_matrix_programs.c"
+
+# Matching led_matrix.h
+LED_FLAGS = {
+    "LED_FLAG_NULL": 0x00,
+    "LED_FLAG_MATCH_ID": 0x01,
+    "LED_FLAG_MATCH_LAYER": 0x02,
+    "LED_FLAG_USE_RGB": 0x04,
+    "LED_FLAG_USE_PATTERN": 0x08,
+    "LED_FLAG_USE_ROTATE_PATTERN": 0x10,
+}
+EFFECTS = {"EF_NONE": 0x00, "EF_OVER": 0x01, "EF_SUBTRACT": 0x02, "EF_SCR_L": 0x04, "EF_SCR_R": 0x08}
+LED_MODES = ["normal", "keys_only", "non_keys_only", "indicators_only"]
+LED_FLAG_UNDERGLOW = 0x02
+
+# Matching led_anim.h
+BREATHE_MS = 5100
+
+POINT_MAX_X = 224
+POINT_MAX_Y = 64
+PIXEL_SCALE = 4
+LED_SIZE = 7
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def field_value(expr, names):
+    expr = expr.strip()
+    # Pattern bounds are floats, flags are names or'ed together
+    if re.fullmatch(r"[\d.]+f?", expr) and "." in expr:
+        return float(expr.rstrip("f"))
+    value = 0
+    for term in expr.split("|"):
+        term = term.strip()
+        value |= names[term] if term in names else int(term, 0)
+    return value
+
+
+def parse_struct(body, names):
+    fields = {}
+    for name, value in re.findall(r"\.(\w+)\s*=\s*([^,}]+)", body):
+        fields[name] = field_value(value, names)
+    return fields
+
+
+def parse_layout():
+    with open(LAYOUT) as f:
+        text = f.read()
+
+    def values(name):
+        m = re.search(r"#define {} \{{(.*?)\n\}}".format(name), text, re.S)
+        if not m:
+            sys.exit("{} not found in config_led_gen.h, run ./gen_led_config.py".format(name))
+        return [int(v) for v in re.findall(r"\d+", m[1])]
+
+    points = values("LED_CONFIG_POINTS")
+    return list(zip(points[0::2], points[1::2])), values("LED_CONFIG_FLAGS")
+
+
+def parse_breathe_curve():
+    with open(CURVES) as f:
+        text = f.read()
+    m = re.search(r"#define LED_ANIM_BREATHE \{(.*?)\n\}", text, re.S)
+    if not m:
+        sys.exit("LED_ANIM_BREATHE not found in led_anim_gen.h, run ./gen_led_anim.py")
+    return [int(v) for v in re.findall(r"-?\d+", m[1])]
+
+
+def parse_instructions(keymap):
+    path = os.path.join(HERE, "keymaps", keymap, "keymap.c")
+    with open(path) as f:
+        text = strip_comments(f.read())
+    m = re.search(r"led_instruction_set\[\]\s*=\s*\{(.*?)\n\};", text, re.S)
+    if not m:
+        sys.exit("led_instruction_set[] not found in " + path)
+    return [parse_struct(body, LED_FLAGS) for body in re.findall(r"\{([^{}]*)\}", m[1])]
+
+
+def parse_programs(qmk):
+    path = os.path.join(os.path.expanduser(qmk), PROGRAMS)
+    try:
+        with open(path) as f:
+            text = strip_comments(f.read())
+    except OSError:
+        sys.exit("Cannot read {}, point --qmk at the QMK checkout build.sh uses".format(path))
+
+    setups = {}
+    for name, body in re.findall(r"led_setup_t\s+(?:PROGMEM\s+)?(\w+)\[\]\s*=\s*\{(.*?)\n\};", text, re.S):
+        setups[name] = [parse_struct(entry, EFFECTS) for entry in re.findall(r"\{([^{}]*)\}", body)]
+    m = re.search(r"led_setups\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        sys.exit("led_setups[] not found in " + path)
+    return [setups[name] for name in re.findall(r"\w+", m[1])]
+
+
+class Pipeline:
+    def __init__(self, points, flags, instructions, setups, speed, breathe_curve, layer):
+        self.points = points
+        self.flags = flags
+        self.instructions = instructions
+        self.setups = setups
+        self.speed = speed
+        self.breathe_curve = breathe_curve
+        self.layer = layer
+        self.instruction_evals = 0
+        self.segment_evals = 0
+
+    def run_pattern(self, setup, rgb, pos, pomod, direction):
+        for f in setup:
+            if f.get("end"):
+                break
+            self.segment_evals += 1
+            po = pos
+            ef = f.get("ef", 0)
+            scroll_right = (not direction and ef & EFFECTS["EF_SCR_R"]) or (direction and ef & EFFECTS["EF_SCR_L"])
+            scroll_left = (not direction and ef & EFFECTS["EF_SCR_L"]) or (direction and ef & EFFECTS["EF_SCR_R"])
+            if scroll_right or scroll_left:
+                po = po - pomod if scroll_right else po + pomod
+                if po > 100:
+                    po -= 100
+                elif po < 0:
+                    po += 100
+            hs, he = f.get("hs", 0), f.get("he", 0)
+            if po < hs or po > he or he == hs:
+                continue
+            po = (po - hs) / (he - hs)
+            values = [po * (f.get(c + "e", 0) - f.get(c + "s", 0)) + f.get(c + "s", 0) for c in "rgb"]
+            if ef & EFFECTS["EF_OVER"]:
+                rgb[:] = values
+            elif ef & EFFECTS["EF_SUBTRACT"]:
+                rgb[:] = [a - b for a, b in zip(rgb, values)]
+            else:
+                rgb[:] = [a + b for a, b in zip(rgb, values)]
+
+    def frame(self, timer, animation_id, mode, direction=1):
+        if self.breathe_curve:
+            # Same phase and interpolation as led_anim.c
+            phase = timer * ((1 << 32) // BREATHE_MS) & 0xFFFFFFFF
+            a, b = self.breathe_curve[phase >> 24], self.breathe_curve[(phase >> 24) + 1]
+            breathe_level = a + (((b - a) * ((phase >> 16) & 0xFF)) >> 8)
+        pomod = (timer // 10) % int(1000 / self.speed) / 10 * self.speed
+
+        frame = []
+        for i, (x, y) in enumerate(self.points):
+            rgb = [0.0, 0.0, 0.0]
+            underglow = self.flags[i] & LED_FLAG_UNDERGLOW
+            skip = (LED_MODES[mode] == "keys_only" and underglow) or \
+                (LED_MODES[mode] == "non_keys_only" and not underglow) or \
+                LED_MODES[mode] == "indicators_only"
+            if not skip:
+                for ins in self.instructions:
+                    if ins.get("end"):
+                        break
+                    self.instruction_evals += 1
+                    flags = ins.get("flags", 0)
+                    if flags & LED_FLAGS["LED_FLAG_MATCH_LAYER"] and ins.get("layer", 0) != self.layer:
+                        continue
+                    if flags & LED_FLAGS["LED_FLAG_MATCH_ID"] and not ins.get("id{}".format(i // 32), 0) >> (i % 32) & 1:
+                        continue
+                    if flags & LED_FLAGS["LED_FLAG_USE_RGB"]:
+                        rgb = [ins.get(c, 0) for c in "rgb"]
+                    elif flags & LED_FLAGS["LED_FLAG_USE_PATTERN"]:
+                        self.run_pattern(self.setups[ins.get("pattern_id", 0)], rgb, x / POINT_MAX_X * 100, pomod, direction)
+                    elif flags & LED_FLAGS["LED_FLAG_USE_ROTATE_PATTERN"]:
+                        self.run_pattern(self.setups[animation_id], rgb, x / POINT_MAX_X * 100, pomod, direction)
+                rgb = [min(255.0, max(0.0, c)) for c in rgb]
+            rgb = [int(c) for c in rgb]
+            if self.breathe_curve:
+                rgb = [c * breathe_level >> 8 for c in rgb]
+            frame.append(tuple(rgb))
+        return frame
+
+
+def write_ppm(path, points, frame):
+    width = (POINT_MAX_X + 2) * PIXEL_SCALE
+    height = (POINT_MAX_Y + 2) * PIXEL_SCALE
+    image = bytearray(width * height * 3)
+    for (x, y), rgb in zip(points, frame):
+        # Layout y grows upwards, images grow downwards
+        left = x * PIXEL_SCALE
+        top = (POINT_MAX_Y - y) * PIXEL_SCALE
+        for row in range(top, min(top + LED_SIZE, height)):
+            for col in range(left, min(left + LED_SIZE, width)):
+                image[(row * width + col) * 3:(row * width + col) * 3 + 3] = bytes(rgb)
+    with open(path, "wb") as f:
+        f.write(b"P6\n%d %d\n255\n" % (width, height))
+        f.write(image)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--keymap", default="mbednarek360")
+    parser.add_argument("--qmk", default="~/qmk_firmware")
+    parser.add_argument("--frames", type=int, default=100)
+    parser.add_argument("--interval", type=int, default=10, help="ms between frames")
+    parser.add_argument("--speed", type=int, default=4, help="led_animation_speed")
+    parser.add_argument("--layer", type=int, default=0)
+    parser.add_argument("--breathing", action="store_true")
+    parser.add_argument("--out", default="led_render", help="image directory, empty to skip images")
+    args = parser.parse_args()
+
+    points, flags = parse_layout()
+    instructions = parse_instructions(args.keymap)
+    setups = parse_programs(args.qmk)
+    breathe_curve = parse_breathe_curve() if args.breathing else None
+
+    print("{:>4} {:<16} {:>12} {:>12}".format("id", "mode", "instr/frame", "segs/frame"))
+    for animation_id in range(len(setups)):
+        for mode in range(len(LED_MODES)):
+            pipeline = Pipeline(points, flags, instructions, setups, args.speed, breathe_curve, args.layer)
+            directory = os.path.join(args.out, "{}_{}".format(animation_id, LED_MODES[mode])) if args.out else None
+            if directory:
+                os.makedirs(directory, exist_ok=True)
+            for n in range(args.frames):
+                frame = pipeline.frame(n * args.interval, animation_id, mode)
+                if directory:
+                    write_ppm(os.path.join(directory, "frame_{:04}.ppm".format(n)), points, frame)
+            print("{:>4} {:<16} {:>12} {:>12}".format(
+                animation_id, LED_MODES[mode],
+                pipeline.instruction_evals // args.frames, pipeline.segment_evals // args.frames))
+    print("Work counts from a model of md_rgb_matrix.c, not cycles: build with LED_BENCH for cycles per frame")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,5 +1,17 @@
 # project specific files
 SRC += config_led.c
+SRC += settings_log.c
+SRC += settings_flash.c
+SRC += frame_budget.c
+SRC += pixel.c
+SRC += led_flush.c
+SRC += led_power.c
+SRC += led_power_model.c
+SRC += idle_power.c
+SRC += led_anim.c
+SRC += led_indicator.c
+SRC += task_sched.c
+SRC += sr_shadow.c
 
 #For platform and packs
 ARM_ATSAM = SAMD51J18A
@@ -23,9 +35,48 @@ AUDIO_ENABLE = no           # Audio output
 VIRTSER_ENABLE = no         # USB Serial Driver
 RAW_ENABLE = no             # Raw device
 AUTO_SHIFT_ENABLE = no      # Auto Shift
+LATENCY_STATS_ENABLE = no   # Scan and key latency histograms, printed with DBG_PRF (see latency.h)
+SOF_SYNC_ENABLE = no        # Scan just ahead of each USB frame, send changed reports only (see sof_sync.h)
+BINLOG_ENABLE = no          # Log format addresses and raw arguments, decoded on the host (see binlog.h)
+
+# Port-wide column reads with a calibrated select delay (matrix.c)
+CUSTOM_MATRIX = lite
+SRC += matrix.c
+
+# Eager press / deferred release debounce per key (debounce.c)
+DEBOUNCE_TYPE = custom
+SRC += debounce.c
 
 # Custom RGB matrix handling
 RGB_MATRIX_ENABLE = yes
 RGB_MATRIX_DRIVER = custom
+# Flush only the PWM registers that changed (led_flush.c takes md_rgb_matrix.c's driver over)
+EXTRALDFLAGS += -Wl,--wrap=rgb_matrix_driver
+# Table-driven keypress-reactive effects (rgb_matrix_kb.inc)
+RGB_MATRIX_CUSTOM_KB = yes
+
+# Shift register changes go out batched from interrupts (sr_shadow.c), the core's polled SR_EXP_WriteData drains them first
+EXTRALDFLAGS += -Wl,--wrap=SR_EXP_WriteData
+
+# Settings log flash area, the link fails if the image grows into it (settings_log.ld)
+# SmartEEPROM takes 2 * SBLK blocks from the end of flash, the log refuses to run if that reaches down to it
+SETTINGS_LOG_ADDR = 0x38000
+OPT_DEFS += -DSETTINGS_LOG_ADDR=$(SETTINGS_LOG_ADDR)
+EXTRALDFLAGS += -Wl,--defsym=SETTINGS_LOG_ADDR=$(SETTINGS_LOG_ADDR) $(KEYBOARD_PATH_1)/settings_log.ld
 
 LAYOUTS = 65_ansi_blocker
+
+ifeq ($(strip $(LATENCY_STATS_ENABLE)), yes)
+    SRC += latency.c
+    OPT_DEFS += -DLATENCY_STATS_ENABLE
+endif
+
+ifeq ($(strip $(BINLOG_ENABLE)), yes)
+    SRC += binlog.c
+    OPT_DEFS += -DBINLOG_ENABLE
+endif
+
+ifeq ($(strip $(SOF_SYNC_ENABLE)), yes)
+    SRC += sof_sync.c
+    OPT_DEFS += -DSOF_SYNC_ENABLE
+endif
@@ -0,0 +1,58 @@
+#include "settings_flash.h"
+
+#include <string.h>
+#include "samd51j18a.h"
+#include "settings_log.h"
+
+_Static_assert(SETTINGS_FLASH_BLOCK_SIZE == NVMCTRL_BLOCK_SIZE, "Settings flash block size does not match the NVM block size");
+_Static_assert(SETTINGS_LOG_ADDR % NVMCTRL_BLOCK_SIZE == 0, "Settings log does not start on a block");
+_Static_assert(SETTINGS_LOG_ADDR + SETTINGS_LOG_BLOCKS * NVMCTRL_BLOCK_SIZE <= FLASH_SIZE, "Settings log runs past the end of flash");
+
+#define NVM_ERRORS (NVMCTRL_INTFLAG_ADDRE | NVMCTRL_INTFLAG_PROGE | NVMCTRL_INTFLAG_LOCKE | NVMCTRL_INTFLAG_NVME)
+
+static bool nvm_command(uint32_t addr, uint16_t cmd) {
+    while (!NVMCTRL->STATUS.bit.READY) {}
+    NVMCTRL->INTFLAG.reg = NVMCTRL_INTFLAG_MASK;
+    NVMCTRL->ADDR.reg = addr;
+    NVMCTRL->CTRLB.reg = NVMCTRL_CTRLB_CMDEX_KEY | cmd;
+    while (!NVMCTRL->STATUS.bit.READY) {}
+
+    return !(NVMCTRL->INTFLAG.reg & NVM_ERRORS);
+}
+
+void settings_flash_read(uint32_t addr, void *data, uint32_t size) {
+    memcpy(data, (const void *)addr, size);
+}
+
+bool settings_flash_write(uint32_t addr, const void *data, uint32_t size) {
+    const uint32_t *src = data;
+    uint16_t ctrla = NVMCTRL->CTRLA.reg;
+    bool ok = true;
+
+    //Manual write mode, each quad-word is committed explicitly with WQW
+    NVMCTRL->CTRLA.reg = (ctrla & ~NVMCTRL_CTRLA_WMODE_Msk) | NVMCTRL_CTRLA_WMODE_MAN;
+
+    for (uint32_t offset = 0; ok && offset < size; offset += SETTINGS_FLASH_WRITE_SIZE) {
+        volatile uint32_t *dst = (volatile uint32_t *)(addr + offset);
+
+        ok = nvm_command(addr + offset, NVMCTRL_CTRLB_CMD_PBC);
+        for (uint8_t i = 0; i < SETTINGS_FLASH_WRITE_SIZE / sizeof(uint32_t); i++) {
+            dst[i] = *src++;
+        }
+        ok = ok && nvm_command(addr + offset, NVMCTRL_CTRLB_CMD_WQW);
+    }
+
+    NVMCTRL->CTRLA.reg = ctrla;
+    return ok;
+}
+
+bool settings_flash_erase(uint32_t addr) {
+    return nvm_command(addr, NVMCTRL_CTRLB_CMD_EB);
+}
+
+//The SmartEEPROM fuses (SBLK) reserve SBLK blocks in each of the two banks at the very end of flash
+bool settings_flash_usable(uint32_t addr, uint32_t size) {
+    uint32_t smarteeprom = FLASH_SIZE - 2 * NVMCTRL->SEESTAT.bit.SBLK * NVMCTRL_BLOCK_SIZE;
+
+    return addr + size <= smarteeprom;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//Raw NVM access used by the settings log
+//The log only touches flash through these calls, so it can be run against a simulated flash
+#define SETTINGS_FLASH_BLOCK_SIZE   8192        //Erase granularity
+#define SETTINGS_FLASH_WRITE_SIZE   16          //Program granularity (one quad-word)
+
+void settings_flash_read(uint32_t addr, void *data, uint32_t size);
+bool settings_flash_write(uint32_t addr, const void *data, uint32_t size);  //addr and size aligned to SETTINGS_FLASH_WRITE_SIZE
+bool settings_flash_erase(uint32_t addr);                                   //addr aligned to SETTINGS_FLASH_BLOCK_SIZE
+bool settings_flash_usable(uint32_t addr, uint32_t size);                   //Range is main flash outside the SmartEEPROM area
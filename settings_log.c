@@ -0,0 +1,212 @@
+#include "settings_log.h"
+
+#include <stddef.h>
+#include <string.h>
+#include "settings_flash.h"
+
+#define SETTINGS_LOG_SLOTS          (SETTINGS_FLASH_BLOCK_SIZE / SETTINGS_LOG_RECORD_SIZE)
+#define SETTINGS_LOG_MAGIC          0x5A
+#define SETTINGS_LOG_ERASED         0xFF
+
+typedef struct __attribute__((aligned(4))) {
+    uint8_t magic;
+    uint8_t version;
+    uint8_t size;
+    uint8_t _reserved;
+    uint32_t seq;
+    uint8_t payload[SETTINGS_LOG_PAYLOAD_SIZE];
+    uint32_t crc;
+} settings_record_t;
+
+_Static_assert(sizeof(settings_record_t) == SETTINGS_LOG_RECORD_SIZE, "Settings record does not fill its slot");
+_Static_assert(SETTINGS_LOG_RECORD_SIZE % SETTINGS_FLASH_WRITE_SIZE == 0, "Settings record is not a whole number of flash writes");
+_Static_assert(SETTINGS_LOG_BLOCKS >= 2, "Settings log needs a spare block to move to when one fills up");
+
+settings_log_stats_t settings_log_stats;
+
+static struct {
+    bool ready;
+    bool usable;                //The log's blocks are clear of the SmartEEPROM area
+    bool valid;                 //latest holds a record read from or written to flash
+    uint8_t block;              //Block currently appended to
+    uint16_t next;              //Next free slot in that block
+    settings_record_t latest;
+} settings_log;
+
+static uint32_t crc32(const void *data, uint32_t size) {
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    const uint8_t *byte = data;
+    uint32_t crc = 0xFFFFFFFF;
+
+    while (size--) {
+        crc = table[(crc ^ *byte) & 0x0F] ^ (crc >> 4);
+        crc = table[(crc ^ (*byte >> 4)) & 0x0F] ^ (crc >> 4);
+        byte++;
+    }
+    return ~crc;
+}
+
+static uint32_t slot_addr(uint8_t block, uint16_t slot) {
+    return SETTINGS_LOG_ADDR + (uint32_t)block * SETTINGS_FLASH_BLOCK_SIZE + (uint32_t)slot * SETTINGS_LOG_RECORD_SIZE;
+}
+
+static bool record_valid(const settings_record_t *record) {
+    return record->magic == SETTINGS_LOG_MAGIC
+        && record->size <= SETTINGS_LOG_PAYLOAD_SIZE
+        && record->crc == crc32(record, offsetof(settings_record_t, crc));
+}
+
+static bool slot_erased(uint8_t block, uint16_t slot) {
+    uint32_t words[SETTINGS_LOG_RECORD_SIZE / sizeof(uint32_t)];
+
+    settings_flash_read(slot_addr(block, slot), words, sizeof(words));
+    for (uint8_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        if (words[i] != 0xFFFFFFFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//Records are only ever appended, so the used slots of a block form a prefix and the end can be binary searched
+static uint16_t used_slots(uint8_t block) {
+    uint16_t lo = 0;
+    uint16_t hi = SETTINGS_LOG_SLOTS;
+
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        uint8_t magic;
+
+        settings_flash_read(slot_addr(block, mid), &magic, sizeof(magic));
+        if (magic == SETTINGS_LOG_ERASED) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+//Newest valid record of a block, stepping back over records torn by a power loss
+static bool newest_record(uint8_t block, uint16_t used, settings_record_t *record) {
+    while (used > 0) {
+        settings_flash_read(slot_addr(block, --used), record, sizeof(*record));
+        if (record_valid(record)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void settings_log_init(void) {
+    settings_record_t record;
+
+    settings_log.ready = true;
+    settings_log.valid = false;
+    settings_log.block = 0;
+    //SmartEEPROM fuses allowing more than the space above the log would put it under the log's blocks
+    settings_log.usable = settings_flash_usable(SETTINGS_LOG_ADDR, SETTINGS_LOG_BLOCKS * SETTINGS_FLASH_BLOCK_SIZE);
+    if (!settings_log.usable) {
+        return;
+    }
+    settings_log.next = used_slots(0);
+
+    for (uint8_t block = 0; block < SETTINGS_LOG_BLOCKS; block++) {
+        uint16_t used = block == 0 ? settings_log.next : used_slots(block);
+
+        if (!newest_record(block, used, &record)) {
+            continue;
+        }
+        if (settings_log.valid && (int32_t)(record.seq - settings_log.latest.seq) <= 0) {
+            continue;
+        }
+        settings_log.valid = true;
+        settings_log.block = block;
+        settings_log.next = used;
+        settings_log.latest = record;
+    }
+}
+
+bool settings_log_read(void *data, uint8_t size, uint8_t *version) {
+    if (!settings_log.ready) {
+        settings_log_init();
+    }
+    if (!settings_log.usable) {
+        settings_log_stats.refused++;
+        return false;
+    }
+    if (!settings_log.valid) {
+        return false;
+    }
+
+    memset(data, 0, size);
+    memcpy(data, settings_log.latest.payload, size < settings_log.latest.size ? size : settings_log.latest.size);
+    *version = settings_log.latest.version;
+    return true;
+}
+
+bool settings_log_write(const void *data, uint8_t size, uint8_t version) {
+    settings_record_t record;
+
+    if (size > SETTINGS_LOG_PAYLOAD_SIZE) {
+        return false;
+    }
+    if (!settings_log.ready) {
+        settings_log_init();
+    }
+    if (!settings_log.usable) {
+        settings_log_stats.refused++;
+        return false;
+    }
+
+    memset(&record, 0, sizeof(record));
+    record.magic = SETTINGS_LOG_MAGIC;
+    record.version = version;
+    record.size = size;
+    record.seq = settings_log.valid ? settings_log.latest.seq + 1 : 1;
+    memcpy(record.payload, data, size);
+    record.crc = crc32(&record, offsetof(settings_record_t, crc));
+
+    if (settings_log.valid
+        && settings_log.latest.version == version
+        && settings_log.latest.size == size
+        && memcmp(settings_log.latest.payload, record.payload, size) == 0) {
+        settings_log_stats.unchanged++;
+        return true;
+    }
+
+    //Slots left dirty by an interrupted write are skipped rather than programmed over
+    while (settings_log.next < SETTINGS_LOG_SLOTS && !slot_erased(settings_log.block, settings_log.next)) {
+        settings_log.next++;
+    }
+
+    //Block is full, continue in the next one
+    //The full block still holds the previous state until the log wraps around to it again
+    if (settings_log.next >= SETTINGS_LOG_SLOTS) {
+        uint8_t block = (settings_log.block + 1) % SETTINGS_LOG_BLOCKS;
+
+        if (!settings_flash_erase(slot_addr(block, 0))) {
+            settings_log_stats.errors++;
+            return false;
+        }
+        settings_log_stats.erases++;
+        settings_log.block = block;
+        settings_log.next = 0;
+    }
+
+    if (!settings_flash_write(slot_addr(settings_log.block, settings_log.next), &record, sizeof(record))) {
+        //The slot is no longer clean, the next write moves past it
+        settings_log.next++;
+        settings_log_stats.errors++;
+        return false;
+    }
+
+    settings_log.next++;
+    settings_log.valid = true;
+    settings_log.latest = record;
+    settings_log_stats.writes++;
+    return true;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//Append-only settings log, wear-levelled over SETTINGS_LOG_BLOCKS flash blocks
+//Every record is a full CRC-checked snapshot of the settings, so the newest valid record is the current state
+//When the active block fills up, the next block is erased and the log continues there
+#ifndef SETTINGS_LOG_ADDR
+#define SETTINGS_LOG_ADDR           0x38000     //Start of the log, set by rules.mk (the link checks the image ends below it)
+#endif
+#ifndef SETTINGS_LOG_BLOCKS
+#define SETTINGS_LOG_BLOCKS         2           //Flash blocks the log rotates through (2 or more)
+#endif
+
+#define SETTINGS_LOG_RECORD_SIZE    32          //Bytes per record, a multiple of SETTINGS_FLASH_WRITE_SIZE
+#define SETTINGS_LOG_PAYLOAD_SIZE   20          //Largest settings struct that fits in one record
+
+typedef struct {
+    uint32_t writes;        //Records appended
+    uint32_t unchanged;     //Writes skipped because the snapshot matched the newest record
+    uint32_t erases;        //Blocks erased when the active block filled up
+    uint32_t errors;        //Failed flash operations
+    uint32_t refused;       //Reads and writes refused because the SmartEEPROM area overlaps the log
+} settings_log_stats_t;
+
+extern settings_log_stats_t settings_log_stats;
+
+//Copies the newest snapshot into data (zero padded to size) and returns its schema version
+bool settings_log_read(void *data, uint8_t size, uint8_t *version);
+//Appends a new snapshot, size must not exceed SETTINGS_LOG_PAYLOAD_SIZE
+bool settings_log_write(const void *data, uint8_t size, uint8_t version);
@@ -0,0 +1,133 @@
+#include "sof_sync.h"
+
+#include <string.h>
+#include "quantum.h"
+#include "host.h"
+#include "samd51j18a.h"
+#include "dwt.h"
+
+#define SOF_SYNC_FNUM_MASK          0x7FF       //11 bit frame number
+#define SOF_SYNC_TIMEOUT            (SOF_SYNC_PERIOD * 3)
+
+sof_sync_stats_t sof_sync_stats;
+
+static bool locked;
+static uint16_t last_fnum;
+static uint32_t last_poll;
+static uint32_t last_change;
+static uint32_t sof;                //Predicted cycle count of the latest SOF
+static bool synced;                 //A scan already ran at this frame's lead point
+
+static host_driver_t *usb_driver;
+static host_driver_t sync_driver;
+static report_keyboard_t last_report;
+static bool report_sent;
+
+//Every poll bounds an SOF to the time since the previous poll. The prediction only moves when it falls
+//outside that, by the least amount that brings it back, so it settles onto the tightest bounds seen.
+//The core clock is locked to the USB clock, so the period itself does not drift.
+static void sof_sync_poll(void) {
+    uint32_t now = dwt_cycles();
+    uint16_t fnum = USB->DEVICE.FNUM.bit.FNUM;
+
+    if (fnum != last_fnum) {
+        sof_sync_stats.frames += (fnum - last_fnum) & SOF_SYNC_FNUM_MASK;
+        last_fnum = fnum;
+        last_change = now;
+        synced = false;
+
+        if (!locked) {
+            sof = now;
+            locked = true;
+        } else {
+            while ((int32_t)(now - (sof + SOF_SYNC_PERIOD)) >= 0) {
+                sof += SOF_SYNC_PERIOD;
+            }
+            //Latest predicted SOF is before the previous poll: either it came late or the next one early
+            if ((int32_t)(sof - last_poll) <= 0) {
+                uint32_t late = last_poll + 1 - sof;
+                uint32_t early = sof + SOF_SYNC_PERIOD - now;
+
+                sof = late <= early ? last_poll + 1 : now;
+                sof_sync_stats.corrections++;
+            }
+        }
+    } else if (locked) {
+        if (now - last_change > SOF_SYNC_TIMEOUT) {
+            //Suspended or unplugged, scan freely until frames come back
+            locked = false;
+        } else if ((int32_t)(now - (sof + SOF_SYNC_PERIOD)) >= 0) {
+            //A predicted SOF passed without the frame number changing, it is still to come
+            sof = now + 1 - SOF_SYNC_PERIOD;
+            sof_sync_stats.corrections++;
+        }
+    }
+    last_poll = now;
+}
+
+static void sync_send_keyboard(report_keyboard_t *report) {
+    //Held keys rescan to the same report, one per change is all the host needs
+    if (report_sent && !memcmp(report, &last_report, sizeof(last_report))) {
+        sof_sync_stats.duplicates++;
+        return;
+    }
+    last_report = *report;
+    report_sent = true;
+    sof_sync_stats.reports++;
+    usb_driver->send_keyboard(report);
+}
+
+//The USB host driver is set up by the protocol's main after the keyboard, so it is wrapped on first use
+static void sof_sync_wrap_driver(void) {
+    host_driver_t *driver = host_get_driver();
+
+    if (!driver || driver == &sync_driver) {
+        return;
+    }
+    usb_driver = driver;
+    sync_driver = *driver;
+    sync_driver.send_keyboard = sync_send_keyboard;
+    host_set_driver(&sync_driver);
+}
+
+void sof_sync_scan(void) {
+    int32_t until;
+
+    sof_sync_wrap_driver();
+    sof_sync_poll();
+    if (!locked || synced) {
+        return;
+    }
+
+    until = sof + SOF_SYNC_PERIOD - SOF_SYNC_LEAD_US * DWT_CYCLES_PER_US - dwt_cycles();
+    if (until > SOF_SYNC_WINDOW_US * (int32_t)DWT_CYCLES_PER_US) {
+        return;
+    }
+    if (until > 0) {
+        uint32_t target = dwt_cycles() + until;
+
+        while ((int32_t)(dwt_cycles() - target) < 0) {}
+        sof_sync_stats.synced++;
+    }
+    synced = true;
+}
+
+uint32_t sof_sync_next(void) {
+    uint32_t now = dwt_cycles();
+    uint32_t next = sof + SOF_SYNC_PERIOD;
+
+    while ((int32_t)(now - next) >= 0) {
+        next += SOF_SYNC_PERIOD;
+    }
+    return next;
+}
+
+void sof_sync_print(void) {
+#ifdef CONSOLE_ENABLE
+    uprintf("SOF sync (%s, lead %u us):\n", locked ? "locked" : "free running", SOF_SYNC_LEAD_US);
+    uprintf("  frames %lu synced %lu corrections %lu\n",
+        sof_sync_stats.frames, sof_sync_stats.synced, sof_sync_stats.corrections);
+    uprintf("  reports %lu duplicates %lu\n", sof_sync_stats.reports, sof_sync_stats.duplicates);
+#endif
+    memset(&sof_sync_stats, 0, sizeof(sof_sync_stats));
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//Opt-in USB frame alignment (SOF_SYNC_ENABLE in rules.mk)
+//The full-speed host polls the keyboard once per 1 ms frame. The SOF interrupt belongs to the USB stack,
+//so the frame phase is tracked on the DWT cycle counter from changes of the frame number register, and one
+//scan and debounce pass per frame is held back to run a fixed lead before the predicted SOF
+#ifndef SOF_SYNC_LEAD_US
+#define SOF_SYNC_LEAD_US            60          //Scan, debounce, key processing and report write before the SOF
+#endif
+#ifndef SOF_SYNC_WINDOW_US
+#define SOF_SYNC_WINDOW_US          100         //Longest wait for the synced scan, later loops scan right away
+#endif
+#define SOF_SYNC_PERIOD             (DWT_CPU_HZ / 1000)
+
+typedef struct {
+    uint32_t frames;        //SOFs seen
+    uint32_t synced;        //Frames with a scan held to the lead point
+    uint32_t corrections;   //Frame number changes outside the predicted window
+    uint32_t reports;       //Keyboard reports passed on to the host
+    uint32_t duplicates;    //Keyboard reports dropped as identical to the last one sent
+} sof_sync_stats_t;
+
+extern sof_sync_stats_t sof_sync_stats;
+
+//From matrix_scan_custom before the rows are read, waits for the lead point when it is close
+void sof_sync_scan(void);
+//Predicted cycle count of the next SOF, so the report of the current scan goes out in that frame
+uint32_t sof_sync_next(void);
+//Prints the frame counters over the console and clears them
+void sof_sync_print(void);
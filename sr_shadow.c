@@ -0,0 +1,187 @@
+#include "sr_shadow.h"
+
+#include "quantum.h"
+#include "arm_atsam_protocol.h"
+
+sr_shadow_stats_t sr_shadow_stats;
+
+//Register values waiting to be latched, oldest at the tail
+//The main loop adds at the head, the interrupts shift out and drop the tail
+static volatile uint16_t queue[SR_SHADOW_QUEUE];
+static volatile uint8_t queue_head;
+static volatile uint8_t queue_tail;
+static volatile uint8_t queue_count;
+static volatile bool shifting;
+
+//The open batch: which bits it changes and what to
+static uint16_t batch_mask;
+static uint16_t batch_bits;
+//Newest value queued or latched. sr_exp_data runs ahead of it with the open batch, and with the core's change on
+//the way to its write, so it always holds the result of every change in program order.
+static uint16_t shadow;
+
+//The batching only touches sr_exp_data and the queue. The SERCOM is only touched from here down to the
+//handlers, so the order values are latched in can be checked off the device against a mock SERCOM.
+
+//Interrupts off or from a handler, with a value queued
+static void shift_next(void) {
+    shifting = true;
+    SR_EXP_RCLK_LO;
+    SR_EXP_SERCOM->SPI.DATA.reg = queue[queue_tail] & 0xFF;
+    SR_EXP_SERCOM->SPI.INTENSET.reg = SERCOM_SPI_INTENSET_DRE;
+}
+
+//The low byte moved to the shift register, same byte order as SR_EXP_WriteData
+void SR_SHADOW_DRE_HANDLER(void) {
+    SR_EXP_SERCOM->SPI.INTENCLR.reg = SERCOM_SPI_INTENCLR_DRE;
+    SR_EXP_SERCOM->SPI.DATA.reg = queue[queue_tail] >> 8;
+    //Left set by the core's blocking writes, or by the low byte if this ran late
+    SR_EXP_SERCOM->SPI.INTFLAG.reg = SERCOM_SPI_INTFLAG_TXC;
+    SR_EXP_SERCOM->SPI.INTENSET.reg = SERCOM_SPI_INTENSET_TXC;
+}
+
+//Both bytes are out, latch them and go on with the next value
+void SR_SHADOW_TXC_HANDLER(void) {
+    SR_EXP_SERCOM->SPI.INTENCLR.reg = SERCOM_SPI_INTENCLR_TXC;
+    SR_EXP_SERCOM->SPI.INTFLAG.reg = SERCOM_SPI_INTFLAG_TXC;
+    SR_EXP_RCLK_HI;
+
+    queue_tail = (queue_tail + 1) % SR_SHADOW_QUEUE;
+    queue_count--;
+    sr_shadow_stats.writes++;
+
+    if (queue_count) {
+        shift_next();
+    } else {
+        shifting = false;
+    }
+}
+
+//Critical sections put PRIMASK back as they found it, the core writes the register with interrupts off too
+static uint32_t irq_save(void) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    return primask;
+}
+
+static void shift_start(void) {
+    uint32_t primask = irq_save();
+
+    if (!shifting && queue_count) {
+        shift_next();
+    }
+    __set_PRIMASK(primask);
+}
+
+void sr_shadow_init(void) {
+    shadow = sr_exp_data.reg;
+    //Only enabled while a value is shifting, so the core's polled writes never raise them
+    SR_EXP_SERCOM->SPI.INTENCLR.reg = SERCOM_SPI_INTENCLR_MASK;
+    NVIC_EnableIRQ(SR_SHADOW_DRE_IRQn);
+    NVIC_EnableIRQ(SR_SHADOW_TXC_IRQn);
+}
+
+bool sr_shadow_busy(void) {
+    return queue_count || shifting;
+}
+
+//Batches build on the shadow, not on sr_exp_data, which may already hold a later change of the core's
+void sr_shadow_commit(void) {
+    uint32_t primask;
+    uint16_t value;
+
+    if (!batch_mask) {
+        return;
+    }
+    value = (shadow & ~batch_mask) | batch_bits;
+    batch_mask = 0;
+    batch_bits = 0;
+
+    if (value == shadow) {
+        sr_shadow_stats.avoided++;
+        return;
+    }
+    if (queue_count == SR_SHADOW_QUEUE) {
+        sr_shadow_stats.stalls++;
+        sr_shadow_wait();
+    }
+    shadow = value;
+
+    primask = irq_save();
+    queue[queue_head] = value;
+    queue_head = (queue_head + 1) % SR_SHADOW_QUEUE;
+    queue_count++;
+    if (queue_count > sr_shadow_stats.max_queue) {
+        sr_shadow_stats.max_queue = queue_count;
+    }
+    __set_PRIMASK(primask);
+}
+
+void sr_shadow_write(uint16_t mask, uint16_t bits) {
+    bits &= mask;
+    sr_shadow_stats.changes++;
+
+    //Merging would lose the state the open batch set these bits to
+    if ((batch_bits ^ bits) & batch_mask & mask) {
+        sr_shadow_commit();
+    } else if (batch_mask) {
+        sr_shadow_stats.avoided++;
+    }
+    batch_mask |= mask;
+    batch_bits = (batch_bits & ~mask) | bits;
+    sr_exp_data.reg = (sr_exp_data.reg & ~mask) | bits;
+}
+
+void sr_shadow_flush(void) {
+    sr_shadow_commit();
+    shift_start();
+}
+
+//Runs the handlers from here instead of waiting for them, so it also finishes with interrupts off
+void sr_shadow_wait(void) {
+    uint32_t primask;
+    uint8_t pending;
+
+    if (!sr_shadow_busy()) {
+        return;
+    }
+    primask = irq_save();
+    if (!shifting) {
+        shift_next();
+    }
+    while (shifting) {
+        pending = SR_EXP_SERCOM->SPI.INTFLAG.reg & SR_EXP_SERCOM->SPI.INTENSET.reg;
+        if (pending & SERCOM_SPI_INTFLAG_DRE) {
+            SR_SHADOW_DRE_HANDLER();
+        } else if (pending & SERCOM_SPI_INTFLAG_TXC) {
+            SR_SHADOW_TXC_HANDLER();
+        }
+    }
+    //Raised while polling, the handlers must not run again for them once interrupts are back on
+    NVIC_ClearPendingIRQ(SR_SHADOW_DRE_IRQn);
+    NVIC_ClearPendingIRQ(SR_SHADOW_TXC_IRQn);
+    __set_PRIMASK(primask);
+}
+
+//Linked in place of the core's SR_EXP_WriteData by -Wl,--wrap=SR_EXP_WriteData (rules.mk). Its polled write takes
+//the SERCOM over, so the open batch and everything queued is latched first and the pins change in program order.
+//The core has already made its change to sr_exp_data, on top of the open batch, so the batch goes out on its own
+//first and the core's write leaves the pins as every change in program order left them.
+extern void __real_SR_EXP_WriteData(void);
+
+void __wrap_SR_EXP_WriteData(void) {
+    sr_shadow_commit();
+    sr_shadow_wait();
+    shadow = sr_exp_data.reg;
+    __real_SR_EXP_WriteData();
+}
+
+void sr_shadow_print(void) {
+#ifdef CONSOLE_ENABLE
+    uprintf("Shift register:\n");
+    uprintf("  changes %lu writes %lu avoided %lu stalls %lu max queue %u\n", sr_shadow_stats.changes,
+        sr_shadow_stats.writes, sr_shadow_stats.avoided, sr_shadow_stats.stalls, sr_shadow_stats.max_queue);
+#endif
+    sr_shadow_stats = (sr_shadow_stats_t){ 0 };
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//Shadow of the SR_EXP shift register (hub and LED driver lines, see config.h) that batches bit changes.
+//Changes made during one main loop pass are merged into one 16-bit write, shifted out over SR_EXP_SERCOM
+//from its data register empty interrupt and latched with RCLK in its transmit complete interrupt.
+//A change to a bit the open batch already changed the other way closes the batch first, so every
+//intermediate state of a sequence (a reset pulse, a power-up order) still reaches the pins in order.
+#ifndef SR_SHADOW_QUEUE
+#define SR_SHADOW_QUEUE             8           //Register values waiting to be shifted out
+#endif
+//Interrupt lines of SR_EXP_SERCOM, these have to follow it
+#ifndef SR_SHADOW_DRE_IRQn
+#define SR_SHADOW_DRE_IRQn          SERCOM2_0_IRQn
+#define SR_SHADOW_DRE_HANDLER       SERCOM2_0_Handler
+#define SR_SHADOW_TXC_IRQn          SERCOM2_1_IRQn
+#define SR_SHADOW_TXC_HANDLER       SERCOM2_1_Handler
+#endif
+
+typedef struct {
+    uint32_t changes;       //Calls to sr_shadow_write
+    uint32_t writes;        //Register values shifted out and latched
+    uint32_t avoided;       //Changes that did not need a write of their own
+    uint32_t stalls;        //Batches that waited for room in the queue
+    uint8_t max_queue;      //Most values waiting at once
+} sr_shadow_stats_t;
+
+extern sr_shadow_stats_t sr_shadow_stats;
+
+//After the core's SR_EXP_Init, takes over the transmit interrupts of SR_EXP_SERCOM
+void sr_shadow_init(void);
+//Sets the bits of mask to those of bits in the open batch, nothing is sent until the batch is flushed
+void sr_shadow_write(uint16_t mask, uint16_t bits);
+//Closes the open batch, so later changes are latched after it even when they touch other bits
+void sr_shadow_commit(void);
+//Once per main loop pass, queues the open batch and starts shifting if the register is idle
+void sr_shadow_flush(void);
+//Waits until every queued value is latched, the core's blocking SR_EXP_WriteData does this first (rules.mk)
+void sr_shadow_wait(void);
+//True while values are queued or being shifted out
+bool sr_shadow_busy(void);
+//Prints the write counters over the console and clears them
+void sr_shadow_print(void);
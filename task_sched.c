@@ -0,0 +1,100 @@
+#include "task_sched.h"
+
+#include <string.h>
+#include "quantum.h"
+#include "dwt.h"
+
+task_sched_totals_t task_sched_totals;
+
+static task_sched_task_t *tasks;
+static uint32_t last_call;
+
+//Periodic tasks by earliest deadline, polled ones only after them and in turn by when they last ran
+static bool runs_before(const task_sched_task_t *task, const task_sched_task_t *other) {
+    if (!task->period_ms != !other->period_ms) {
+        return task->period_ms;
+    }
+    if (!task->period_ms) {
+        return (int32_t)(task->release - other->release) < 0;
+    }
+    return (int32_t)(task->release + task->deadline_ms - (other->release + other->deadline_ms)) < 0;
+}
+
+void task_sched_add(task_sched_task_t *task) {
+    task->release = timer_read32();
+    task->next = tasks;
+    tasks = task;
+}
+
+void task_sched_run(void) {
+    uint32_t now = timer_read32();
+    task_sched_task_t *next = NULL;
+    uint32_t start = dwt_cycles();
+    uint32_t cycles;
+
+    //The first call after a print has nothing to measure against
+    if (task_sched_totals.loops && start - last_call > task_sched_totals.max_loop_cycles) {
+        task_sched_totals.max_loop_cycles = start - last_call;
+    }
+    last_call = start;
+    task_sched_totals.loops++;
+    for (task_sched_task_t *task = tasks; task; task = task->next) {
+        if ((int32_t)(now - task->release) < 0) {
+            continue;
+        }
+        if (!next || runs_before(task, next)) {
+            next = task;
+        }
+    }
+    if (!next) {
+        task_sched_totals.idle++;
+        return;
+    }
+
+    start = dwt_cycles();
+    next->run();
+    cycles = dwt_cycles() - start;
+
+    //The deadline is for the task to have finished
+    next->stats.runs++;
+    if ((int32_t)(timer_read32() - (next->release + next->deadline_ms)) > 0) {
+        next->stats.late++;
+    }
+    if (cycles > next->budget_us * DWT_CYCLES_PER_US) {
+        next->stats.overruns++;
+    }
+    if (cycles > next->stats.max_cycles) {
+        next->stats.max_cycles = cycles;
+    }
+    if (cycles > task_sched_totals.max_cycles) {
+        task_sched_totals.max_cycles = cycles;
+    }
+
+    //Releases stay on the period grid, but a task that fell a whole period behind is not run back to back
+    if (!next->period_ms) {
+        next->release = now;
+        return;
+    }
+    next->release += next->period_ms;
+    if ((int32_t)(now - next->release) >= (int32_t)next->period_ms) {
+        next->stats.skipped += (now - next->release) / next->period_ms;
+        next->release = now;
+    }
+}
+
+void task_sched_print(void) {
+#ifdef CONSOLE_ENABLE
+    uprintf("Housekeeping tasks (worst scan delay %lu us, worst loop %lu us, idle %lu of %lu loops):\n",
+        task_sched_totals.max_cycles / DWT_CYCLES_PER_US, task_sched_totals.max_loop_cycles / DWT_CYCLES_PER_US,
+        task_sched_totals.idle, task_sched_totals.loops);
+#endif
+    for (task_sched_task_t *task = tasks; task; task = task->next) {
+#ifdef CONSOLE_ENABLE
+        uprintf("  %-10s runs %lu late %lu skipped %lu overruns %lu max %lu/%u us\n", task->name,
+            task->stats.runs, task->stats.late, task->stats.skipped, task->stats.overruns,
+            task->stats.max_cycles / DWT_CYCLES_PER_US, task->budget_us);
+#endif
+        task->stats = (task_sched_stats_t){ 0 };
+    }
+    task_sched_totals = (task_sched_totals_t){ 0 };
+}
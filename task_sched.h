@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//Cooperative scheduler for the housekeeping work around the matrix scan
+//Every task is released once per period and has to finish within its deadline. Each main loop iteration
+//runs at most one due task, the one with the earliest deadline, after keyboard_task has scanned and sent
+//its reports, so a scan comes between any two tasks and a task can only delay it by its own run time.
+//Tasks without a period are polled in turn on the iterations no periodic task is due.
+//Run times are measured with the DWT counter against each task's budget, lateness against the time a run
+//finished, and the time between calls gives the longest main loop iteration, scan and LED frame included.
+
+typedef struct {
+    uint32_t runs;
+    uint32_t late;          //Finished after the deadline had passed
+    uint32_t overruns;      //Ran longer than the budget
+    uint32_t skipped;       //Releases dropped because the task fell a whole period behind
+    uint32_t max_cycles;    //Longest run
+} task_sched_stats_t;
+
+typedef struct task_sched_task {
+    const char *name;
+    void (*run)(void);
+    uint16_t period_ms;     //Time between releases, 0 to poll it whenever nothing else is due
+    uint16_t deadline_ms;   //Latest finish after a release
+    uint16_t budget_us;     //Longest run the task is allowed
+    uint32_t release;       //timer_read32 of the pending release
+    task_sched_stats_t stats;
+    struct task_sched_task *next;
+} task_sched_task_t;
+
+#define TASK_SCHED_TASK(var, task_name, fn, period, deadline, budget) \
+    task_sched_task_t var = { .name = task_name, .run = fn, .period_ms = period, .deadline_ms = deadline, .budget_us = budget }
+
+typedef struct {
+    uint32_t loops;         //Main loop iterations
+    uint32_t idle;          //Iterations with no task due
+    uint32_t max_cycles;    //Longest any task held up the next scan
+    uint32_t max_loop_cycles;   //Longest main loop iteration, from one task_sched_run call to the next
+} task_sched_totals_t;
+
+extern task_sched_totals_t task_sched_totals;
+
+//Adds a task, released right away, from an init hook
+void task_sched_add(task_sched_task_t *task);
+//Runs the due task with the earliest deadline, once per main loop iteration
+void task_sched_run(void);
+//Prints the per-task statistics over the console and clears them
+void task_sched_print(void);
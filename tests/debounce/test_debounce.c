@@ -0,0 +1,166 @@
+//Raw switch traces go through debounce.c one scan at a time. The debounced state must follow each trace exactly:
+//a press on its first edge, bounce inside the press lockout ignored, a release DEBOUNCE ms after the last edge.
+//
+//Traces are one character per ms, X pressed and _ released, and every ms is scanned SCANS_PER_MS times like
+//the real matrix (several kHz). The expected trace is the debounced state after the last scan of each ms.
+
+#include <assert.h>
+#include <stdio.h>
+#include "quantum.h"
+#include "matrix.h"
+#include "debounce.h"
+
+#define SCANS_PER_MS 4
+
+uint32_t timer_ms;
+
+static matrix_row_t raw[MATRIX_ROWS];
+static matrix_row_t cooked[MATRIX_ROWS];
+
+static void reset(void) {
+    memset(raw, 0, sizeof(raw));
+    memset(cooked, 0, sizeof(cooked));
+    timer_ms = 1000;
+    debounce_init(MATRIX_ROWS);
+}
+
+static void scan(void) {
+    debounce(raw, cooked, MATRIX_ROWS, true);
+}
+
+static void set_key(uint8_t row, uint8_t col, bool pressed) {
+    matrix_row_t bit = (matrix_row_t)1 << col;
+
+    raw[row] = pressed ? raw[row] | bit : raw[row] & ~bit;
+}
+
+static bool key_down(uint8_t row, uint8_t col) {
+    return cooked[row] & ((matrix_row_t)1 << col);
+}
+
+//Replays raw traces on several keys at once and checks each key's debounced trace
+static void replay(const char *name, uint8_t keys, const uint8_t position[][2], const char *const trace[],
+    const char *const expected[]) {
+    size_t length = strlen(trace[0]);
+    char got[keys][length + 1];
+    bool ok = true;
+
+    reset();
+    for (size_t ms = 0; ms < length; ms++, timer_ms++) {
+        for (uint8_t key = 0; key < keys; key++) {
+            set_key(position[key][0], position[key][1], trace[key][ms] == 'X');
+        }
+        for (int i = 0; i < SCANS_PER_MS; i++) {
+            scan();
+        }
+        for (uint8_t key = 0; key < keys; key++) {
+            got[key][ms] = key_down(position[key][0], position[key][1]) ? 'X' : '_';
+        }
+    }
+    for (uint8_t key = 0; key < keys; key++) {
+        got[key][length] = 0;
+        if (strcmp(got[key], expected[key])) {
+            fprintf(stderr, "%s, key %u:\n  raw      %s\n  expected %s\n  got      %s\n", name, key, trace[key],
+                expected[key], got[key]);
+            ok = false;
+        }
+    }
+    assert(ok);
+    assert(!debounce_active());
+}
+
+static void replay_key(const char *name, const char *trace, const char *expected) {
+    static const uint8_t position[][2] = { { 2, 7 } };
+
+    replay(name, 1, position, (const char *const[]){ trace }, (const char *const[]){ expected });
+}
+
+int main(void) {
+    _Static_assert(DEBOUNCE == 5, "The traces below are written for DEBOUNCE 5");
+
+    replay_key("clean tap",
+        "___XXXXXXXXXX_______________",
+        "___XXXXXXXXXXXXXXX__________");
+
+    //Press bounce within the lockout is not seen, the press goes out on the first edge
+    replay_key("press bounce",
+        "___X_X_XXXXXXXXXX___________",
+        "___XXXXXXXXXXXXXXXXXXX______");
+
+    //Release bounce: every return to pressed restarts the release window, no second press is reported
+    replay_key("release chatter",
+        "XXXXXXXX_X__X_X_____________",
+        "XXXXXXXXXXXXXXXXXXXX________");
+
+    //Released while the press is still locked out: the release window starts when the lockout ends
+    replay_key("release during lockout",
+        "___XX_______________________",
+        "___XXXXXXXXXX_______________");
+
+    //A single-ms spike on an idle key is reported, the cost of an eager press, and cleared as a short tap
+    replay_key("idle chatter",
+        "___X________________________",
+        "___XXXXXXXXXX_______________");
+
+    //Chatter throughout a hold changes nothing while any edge keeps coming back within the window
+    replay_key("held chatter",
+        "__XXX_XXX_XXXX_XXX_X________",
+        "__XXXXXXXXXXXXXXXXXXXXXXX___");
+
+    //Pressed again right after a completed release: a new press, reported at once
+    replay_key("fast retap",
+        "_XXXXXXX______XXXXX_________",
+        "_XXXXXXXXXXXX_XXXXXXXXXX____");
+
+    //Keys sharing a row and a column run their own windows
+    {
+        static const uint8_t position[][2] = { { 1, 3 }, { 1, 4 }, { 3, 4 } };
+        static const char *const trace[] = {
+            "_XXXXXXXXX_X________________",
+            "___X_XXXX___________________",
+            "XXXXXXXX_X__________________",
+        };
+        static const char *const expected[] = {
+            "_XXXXXXXXXXXXXXXX___________",
+            "___XXXXXXXXXXX______________",
+            "XXXXXXXXXXXXXXX_____________",
+        };
+
+        replay("rollover", 3, position, trace, expected);
+    }
+
+    //A long gap between scans (the loop stalled) counts at most a full window, never wraps a timer
+    reset();
+    set_key(0, 0, true);
+    scan();
+    assert(key_down(0, 0));
+    set_key(0, 0, false);
+    timer_ms += 2;
+    scan();
+    assert(key_down(0, 0) && debounce_active());
+    timer_ms += 200;
+    scan();
+    assert(key_down(0, 0));
+    timer_ms += DEBOUNCE - 1;
+    scan();
+    assert(key_down(0, 0));
+    timer_ms += 1;
+    scan();
+    assert(!key_down(0, 0) && !debounce_active());
+
+    //16-bit timer wraparound between scans
+    reset();
+    timer_ms = 0xFFFE;
+    debounce_init(MATRIX_ROWS);
+    set_key(4, 14, true);
+    scan();
+    timer_ms += DEBOUNCE;
+    set_key(4, 14, false);
+    scan();
+    timer_ms += DEBOUNCE;
+    scan();
+    assert(!key_down(4, 14) && !debounce_active());
+
+    printf("debounce: ok\n");
+    return 0;
+}
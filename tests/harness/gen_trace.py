@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Turns a .keys script into a key event trace for the harness.
+
+Script lines (# starts a comment):
+  type <text>       types the rest of the line on the base layer, shifting as needed
+  tap <key>...      presses and releases each key in turn
+  hold <key>...     presses the keys and keeps them down
+  release <key>...  releases held keys
+  wait <ms>         idles
+  pace <hold> <gap> sets how long taps are held and how far apart they start, in ms (default 50-100 and 70-150),
+                    each a single value or a min-max range; held keys go down and up half a gap apart
+
+Keys are named by what they are on the base layer (Colemak): a-z, digits, punctuation, esc, bspc, del, tab,
+home, caps, ent, pgup, lsft, rsft, up, pgdn, lctl, lgui, lalt, spc, osl3, mo1, left, down, rght. Timing is
+pseudo-random but fixed per script, around 100 wpm with some rollover between keys.
+
+Usage: gen_trace.py script.keys > script.trace
+"""
+
+import os
+import random
+import sys
+
+# Base layer by matrix position, None where the matrix has no key
+MATRIX = [
+    ["esc", "1", "2", "3", "4", "5", "6", "7", "8", "9", "0", "-", "=", "bspc", "del"],
+    ["tab", "q", "w", "f", "p", "b", "j", "l", "u", "y", ";", "[", "]", "\\", "home"],
+    ["caps", "a", "r", "s", "t", "g", "m", "n", "e", "i", "o", "'", None, "ent", "pgup"],
+    ["lsft", None, "x", "c", "d", "v", "z", "k", "h", ",", ".", "/", "rsft", "up", "pgdn"],
+    ["lctl", "lgui", "lalt", None, None, None, "spc", None, None, None, "osl3", "mo1", "left", "down", "rght"],
+]
+
+POSITIONS = {name: (row, col) for row, names in enumerate(MATRIX) for col, name in enumerate(names) if name}
+
+SHIFTED = dict(zip('!@#$%^&*()_+{}|:"<>?~', r"1234567890-=[]\;',./`"))
+NAMED = {" ": "spc", "\n": "ent"}
+
+
+def char_key(char):
+    if char in NAMED:
+        return NAMED[char], False
+    if char.isupper():
+        return char.lower(), True
+    if char in SHIFTED:
+        return SHIFTED[char], True
+    return char, False
+
+
+class Trace:
+    def __init__(self, seed):
+        self.random = random.Random(seed)
+        self.time = 0
+        self.events = []
+        self.down = {}
+        self.hold = (50, 100)
+        self.gap = (70, 150)
+
+    def press(self, name):
+        if name not in POSITIONS:
+            sys.exit(f"unknown key {name!r}")
+        self.events.append((self.time, POSITIONS[name], "d"))
+        self.down[name] = self.time
+
+    def release(self, name, at=None):
+        self.events.append((at if at is not None else self.time, POSITIONS[name], "u"))
+        del self.down[name]
+
+    def tap(self, name):
+        self.press(name)
+        self.release(name, self.time + self.random.randint(*self.hold))
+        self.time += self.random.randint(*self.gap)
+
+    def type(self, text):
+        for char in text:
+            name, shift = char_key(char)
+            if shift:
+                self.press("lsft")
+                self.time += self.random.randint(20, 40)
+            self.tap(name)
+            if shift:
+                self.release("lsft")
+                self.time += self.random.randint(10, 30)
+
+    def lines(self):
+        for time, (row, col), edge in sorted(self.events, key=lambda event: event[0]):
+            yield f"{time} {row} {col} {edge}"
+
+
+def main():
+    path = sys.argv[1]
+    script = os.path.basename(path)
+    trace = Trace(script)
+
+    for number, line in enumerate(open(path), 1):
+        command, _, rest = line.rstrip("\n").partition(" ")
+        if not command or command.startswith("#"):
+            continue
+        if command == "type":
+            trace.type(rest)
+        elif command == "tap":
+            for name in rest.split():
+                trace.tap(name)
+        elif command == "hold":
+            for name in rest.split():
+                trace.press(name)
+                trace.time += trace.random.randint(*trace.gap) // 2
+        elif command == "release":
+            for name in rest.split():
+                trace.release(name)
+                trace.time += trace.random.randint(*trace.gap) // 2
+        elif command == "pace":
+            trace.hold, trace.gap = (tuple(int(ms) for ms in (value + "-" + value).split("-")[:2]) for value in rest.split())
+        elif command == "wait":
+            trace.time += int(rest)
+        else:
+            sys.exit(f"{path}:{number}: unknown command {command!r}")
+
+    print(f"# Generated by gen_trace.py from {script}")
+    print("# <ms> <row> <col> <d|u>")
+    for line in trace.lines():
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,503 @@
+//Replays key event traces through the real keymap (keymap.c, driver.c) and the Unicode queue, settings log and
+//task scheduler behind it. QMK's action layer, the USB reports and the flash are stood in for here, the LED
+//modules are stubbed out. Time is simulated: the main loop advances it between events and every DWT read
+//advances it a little, so code that waits on the cycle counter holds the simulated loop up just as it would
+//on the board.
+//
+//  harness [-n repeats] [-q] trace...
+//
+//A trace line is "<ms> <row> <col> <d|u>", times from the start of the trace. The typed text (as the host
+//would type it, Unicode input decoded) goes to stdout, the costs to stderr.
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
+#include "quantum.h"
+#include "matrix.h"
+#include "dwt.h"
+#include "md_rgb_matrix.h"
+#include "usb/usb2422.h"
+#include "led_power.h"
+#include "settings_log.h"
+#include "task_sched.h"
+#include "flash_sim.h"
+#include "unicode_queue.h"
+
+//Cycles a DWT read stands for: the code run between two reads of a busy wait
+#define HARNESS_READ_CYCLES         50
+//Simulated main loop iteration while a glyph is being typed
+#define HARNESS_LOOP_CYCLES         (100 * DWT_CYCLES_PER_US)
+#define HARNESS_CYCLES_PER_MS       (DWT_CYCLES_PER_US * 1000)
+#define HARNESS_TEXT_MAX            (1 << 16)
+//Idle time after each trace, long enough for driver.c to commit changed settings
+#define HARNESS_SETTLE_MS           3500
+
+//QMK and core state the keymap reads
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+keymap_config_t keymap_config;
+bool debug_enable;
+bool debug_matrix;
+bool debug_keyboard;
+bool debug_mouse;
+uint8_t gcr_desired;
+uint8_t led_animation_id;
+uint8_t led_animation_direction;
+uint8_t led_animation_speed;
+uint8_t led_lighting_mode;
+uint8_t led_setups_count = 7;
+uint8_t usb_gcr_auto;
+bool led_power_limit = true;
+bool led_anim_breathing;
+CoreDebug_Type mock_core_debug;
+uint32_t timer_ms;
+
+static uint64_t sim_cycles;
+static DWT_Type dwt;
+
+typedef struct {
+    uint32_t events;
+    uint32_t reports;
+    uint32_t other_keys;        //Presses of keycodes the stand-in action layer does not type
+    uint32_t led_changes;       //LED driver shutdown changes (SDB_N) sent to the shift register
+    uint64_t record_cycles;     //Simulated cycles spent in process_record
+    uint64_t record_cycles_max;
+    uint64_t host_ns;           //Host time spent in process_record
+    uint64_t host_ns_max;
+    uint64_t host_tsc;          //Host cycles spent in process_record (x86 only)
+} harness_stats_t;
+
+static harness_stats_t stats;
+
+//Keys and modifiers the keymap has added since the last report, and what the host last got
+static uint8_t mods;
+static uint8_t keys[32];
+static uint8_t sent_mods;
+static uint8_t sent_keys[32];
+static led_t host_leds;
+
+//What the host typed, Ctrl+Shift+U entries decoded
+static char text[HARNESS_TEXT_MAX];
+static uint32_t text_length;
+static bool unicode_entry;
+static uint32_t unicode_value;
+
+static uint8_t source_layer[MATRIX_ROWS][MATRIX_COLS];
+static int8_t oneshot_layer = -1;
+static bool oneshot_held;
+static bool oneshot_used;
+
+DWT_Type *mock_dwt(void) {
+    sim_cycles += HARNESS_READ_CYCLES;
+    dwt.CYCCNT = (uint32_t)sim_cycles;
+    timer_ms = (uint32_t)(sim_cycles / HARNESS_CYCLES_PER_MS);
+    return &dwt;
+}
+
+static void sim_advance(uint64_t cycles) {
+    sim_cycles += cycles;
+    dwt.CYCCNT = (uint32_t)sim_cycles;
+    timer_ms = (uint32_t)(sim_cycles / HARNESS_CYCLES_PER_MS);
+}
+
+//Stubs for what driver.c reaches into the LED modules for
+void led_anim_set_breathing(bool breathing) { led_anim_breathing = breathing; }
+void led_flush_print(void) {}
+void led_power_print(void) {}
+void led_indicator_print(void) {}
+void idle_power_print(void) {}
+void matrix_scan_print(void) {}
+void sr_shadow_print(void) {}
+
+void sr_shadow_write(uint16_t mask, uint16_t bits) {
+    (void)mask;
+    (void)bits;
+    stats.led_changes++;
+}
+
+//No settings from an older build, the log starts from the defaults
+uint32_t eeconfig_read_kb(void) {
+    return 0x0000A51F;
+}
+
+void reset_keyboard(void) {
+    fprintf(stderr, "reset_keyboard at %u ms\n", timer_ms);
+}
+
+uint8_t get_mods(void) {
+    return mods;
+}
+
+void set_mods(uint8_t new_mods) {
+    mods = new_mods;
+}
+
+void add_key(uint8_t key) {
+    keys[key / 8] |= 1 << (key % 8);
+}
+
+void del_key(uint8_t key) {
+    keys[key / 8] &= ~(1 << (key % 8));
+}
+
+led_t host_keyboard_led_state(void) {
+    return host_leds;
+}
+
+static void type_string(const char *string) {
+    size_t length = strlen(string);
+
+    if (text_length + length < HARNESS_TEXT_MAX) {
+        memcpy(&text[text_length], string, length);
+        text_length += length;
+    }
+}
+
+static void type_code_point(uint32_t code_point) {
+    char utf8[5] = { 0 };
+
+    if (code_point < 0x80) {
+        utf8[0] = code_point;
+    } else if (code_point < 0x800) {
+        utf8[0] = 0xC0 | code_point >> 6;
+        utf8[1] = 0x80 | (code_point & 0x3F);
+    } else if (code_point < 0x10000) {
+        utf8[0] = 0xE0 | code_point >> 12;
+        utf8[1] = 0x80 | (code_point >> 6 & 0x3F);
+        utf8[2] = 0x80 | (code_point & 0x3F);
+    } else {
+        utf8[0] = 0xF0 | code_point >> 18;
+        utf8[1] = 0x80 | (code_point >> 12 & 0x3F);
+        utf8[2] = 0x80 | (code_point >> 6 & 0x3F);
+        utf8[3] = 0x80 | (code_point & 0x3F);
+    }
+    type_string(utf8);
+}
+
+//US layout, the keycodes from KC_A up to KC_SLASH (escape and backspace are handled apart)
+static const char unshifted[] = "abcdefghijklmnopqrstuvwxyz1234567890\n??\t -=[]\\#;'`,./";
+static const char shifted[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ!@#$%^&*()\n??\t _+{}|~:\"~<>?";
+
+static int hex_digit(uint8_t key) {
+    if (key == KC_0) {
+        return 0;
+    }
+    if (key >= KC_1 && key <= KC_9) {
+        return key - KC_1 + 1;
+    }
+    return key >= KC_A && key <= KC_F ? key - KC_A + 10 : -1;
+}
+
+//A key newly down in a report, as the host handles it (Linux, IBus Unicode entry)
+static void host_key(uint8_t key, uint8_t report_mods) {
+    bool shift = report_mods & (MOD_BIT(KC_LSFT) | MOD_BIT(KC_RSFT));
+    bool ctrl = report_mods & (MOD_BIT(KC_LCTL) | MOD_BIT(KC_RCTL));
+    char name[8];
+
+    if (ctrl && shift && key == KC_U) {
+        unicode_entry = true;
+        unicode_value = 0;
+        return;
+    }
+    if (unicode_entry) {
+        if (key == KC_SPC || key == KC_ENT) {
+            unicode_entry = false;
+            type_code_point(unicode_value);
+        } else if (hex_digit(key) >= 0) {
+            unicode_value = unicode_value << 4 | hex_digit(key);
+        } else {
+            type_string("<bad unicode entry>");
+            unicode_entry = false;
+        }
+        return;
+    }
+    if (key == KC_CAPS) {
+        host_leds.caps_lock = !host_leds.caps_lock;
+        return;
+    }
+    if (key == KC_BSPC && !ctrl) {
+        //Takes back the last character, UTF-8 continuation bytes included
+        while (text_length && (text[--text_length] & 0xC0) == 0x80) {}
+        return;
+    }
+    if (key >= KC_A && key <= KC_SLASH && key != KC_ESC && !ctrl) {
+        bool upper = shift ^ (host_leds.caps_lock && key <= KC_Z);
+
+        name[0] = upper ? shifted[key - KC_A] : unshifted[key - KC_A];
+        name[1] = 0;
+    } else {
+        snprintf(name, sizeof(name), "<%02X>", key);
+    }
+    type_string(name);
+}
+
+void send_keyboard_report(void) {
+    stats.reports++;
+    //The host goes through the keys of a report in usage order
+    for (uint16_t key = 0; key < 256; key++) {
+        bool down = keys[key / 8] & (1 << (key % 8));
+        bool was = sent_keys[key / 8] & (1 << (key % 8));
+
+        if (down && !was) {
+            host_key(key, mods);
+        }
+    }
+    memcpy(sent_keys, keys, sizeof(keys));
+    sent_mods = mods;
+}
+
+static void layer_state_set(layer_state_t state) {
+    layer_state = layer_state_set_user(state);
+}
+
+static void basic_code(uint8_t code, bool pressed) {
+    if (code >= KC_A && code <= KC_UP) {
+        if (pressed) {
+            add_key(code);
+        } else {
+            del_key(code);
+        }
+        send_keyboard_report();
+    } else if (code >= KC_LCTL && code <= KC_RGUI) {
+        mods = pressed ? mods | MOD_BIT(code) : mods & ~MOD_BIT(code);
+        send_keyboard_report();
+    } else if (code != KC_NO && pressed) {
+        stats.other_keys++;
+    }
+}
+
+void register_code(uint8_t code) {
+    basic_code(code, true);
+}
+
+void unregister_code(uint8_t code) {
+    basic_code(code, false);
+}
+
+//The part of QMK's action layer the keymap uses: basic keys, modifiers, MO, TG, OSL and NKRO toggling
+static void process_action(uint16_t keycode, bool pressed) {
+    uint8_t layer = keycode & 0xFF;
+
+    if (keycode <= QK_BASIC_MAX) {
+        basic_code(keycode, pressed);
+    } else if ((keycode & 0xFF00) == QK_MOMENTARY) {
+        layer_state_set(pressed ? layer_state | 1UL << layer : layer_state & ~(1UL << layer));
+    } else if ((keycode & 0xFF00) == QK_TOGGLE_LAYER) {
+        if (pressed) {
+            layer_state_set(layer_state ^ 1UL << layer);
+        }
+    } else if ((keycode & 0xFF00) == QK_ONE_SHOT_LAYER) {
+        oneshot_held = pressed;
+        if (pressed) {
+            oneshot_layer = layer;
+            oneshot_used = false;
+            layer_state_set(layer_state | 1UL << layer);
+        } else if (oneshot_used) {
+            layer_state_set(layer_state & ~(1UL << layer));
+            oneshot_layer = -1;
+        }
+    } else if (keycode == NK_TOGG) {
+        if (pressed) {
+            keymap_config.nkro = !keymap_config.nkro;
+        }
+    } else if (keycode != KC_NO && pressed) {
+        stats.other_keys++;
+    }
+}
+
+//layer_switch_get_layer: the highest active layer the key is not transparent on, recorded for its release
+static uint8_t source_layer_find(keypos_t key) {
+    layer_state_t state = layer_state | default_layer_state;
+
+    for (int8_t layer = 31; layer >= 0; layer--) {
+        if ((state & 1UL << layer) && keymap_key_to_keycode(layer, key) != KC_TRNS) {
+            return layer;
+        }
+    }
+    return 0;
+}
+
+static void process_record(keyrecord_t *record) {
+    keypos_t key = record->event.key;
+    bool pressed = record->event.pressed;
+    uint8_t layer;
+    uint16_t keycode;
+
+    if (pressed) {
+        layer = source_layer_find(key);
+        source_layer[key.row][key.col] = layer;
+    } else {
+        layer = source_layer[key.row][key.col];
+    }
+    keycode = keymap_key_to_keycode(layer, key);
+
+    if (process_record_user(keycode, record)) {
+        process_action(keycode, pressed);
+    }
+
+    //A one-shot layer covers the next key pressed
+    if (pressed && oneshot_layer >= 0 && (keycode & 0xFF00) != QK_ONE_SHOT_LAYER) {
+        oneshot_used = true;
+        if (!oneshot_held) {
+            layer_state_set(layer_state & ~(1UL << oneshot_layer));
+            oneshot_layer = -1;
+        }
+    }
+}
+
+static uint64_t host_ns(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void key_event(uint8_t row, uint8_t col, bool pressed) {
+    keyrecord_t record = { .event = { .key = { .row = row, .col = col }, .pressed = pressed, .time = timer_read() | 1 } };
+    uint64_t start_cycles = sim_cycles;
+    uint64_t start_ns = host_ns();
+#ifdef __x86_64__
+    uint64_t start_tsc = __rdtsc();
+#endif
+    uint64_t cycles, ns;
+
+    process_record(&record);
+
+#ifdef __x86_64__
+    stats.host_tsc += __rdtsc() - start_tsc;
+#endif
+    ns = host_ns() - start_ns;
+    cycles = sim_cycles - start_cycles;
+    stats.events++;
+    stats.host_ns += ns;
+    stats.record_cycles += cycles;
+    if (ns > stats.host_ns_max) {
+        stats.host_ns_max = ns;
+    }
+    if (cycles > stats.record_cycles_max) {
+        stats.record_cycles_max = cycles;
+    }
+}
+
+//Main loop iterations up to the given time, in short steps only while something is being typed out
+static void main_loop_until(uint64_t cycles) {
+    while (sim_cycles < cycles) {
+        task_sched_run();
+        if (unicode_queue_busy()) {
+            sim_advance(HARNESS_LOOP_CYCLES);
+        } else {
+            sim_advance(cycles - sim_cycles < HARNESS_CYCLES_PER_MS ? cycles - sim_cycles : HARNESS_CYCLES_PER_MS);
+        }
+    }
+}
+
+//Every key of a trace is released by its end, so anything the host still holds is stuck and goes in the output
+static void report_stuck(void) {
+    char name[16];
+
+    for (uint16_t key = 0; key < 256; key++) {
+        if (sent_keys[key / 8] & (1 << (key % 8))) {
+            snprintf(name, sizeof(name), "<stuck %02X>", key);
+            type_string(name);
+        }
+    }
+    if (sent_mods) {
+        snprintf(name, sizeof(name), "<stuck mods %02X>", sent_mods);
+        type_string(name);
+    }
+}
+
+static uint32_t replay(const char *path, uint64_t *end) {
+    FILE *file = fopen(path, "r");
+    char line[128];
+    uint64_t start = sim_cycles;
+    uint32_t events = 0;
+
+    if (!file) {
+        perror(path);
+        exit(2);
+    }
+    while (fgets(line, sizeof(line), file)) {
+        unsigned ms, row, col;
+        char edge;
+
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if (sscanf(line, "%u %u %u %c", &ms, &row, &col, &edge) != 4 || row >= MATRIX_ROWS || col >= MATRIX_COLS
+            || (edge != 'd' && edge != 'u')) {
+            fprintf(stderr, "%s: bad line: %s", path, line);
+            exit(2);
+        }
+        main_loop_until(start + (uint64_t)ms * HARNESS_CYCLES_PER_MS);
+        key_event(row, col, edge == 'd');
+        events++;
+        if (start + (uint64_t)ms * HARNESS_CYCLES_PER_MS > *end) {
+            *end = start + (uint64_t)ms * HARNESS_CYCLES_PER_MS;
+        }
+    }
+    fclose(file);
+    return events;
+}
+
+int main(int argc, char **argv) {
+    int repeats = 1;
+    bool quiet = false;
+    int opt;
+    uint64_t start_ns, end = 0;
+
+    while ((opt = getopt(argc, argv, "n:q")) != -1) {
+        if (opt == 'n') {
+            repeats = atoi(optarg);
+        } else if (opt == 'q') {
+            quiet = true;
+        } else {
+            fprintf(stderr, "usage: %s [-n repeats] [-q] trace...\n", argv[0]);
+            return 2;
+        }
+    }
+
+    //Power on: an empty settings log, NKRO forced on (FORCE_NKRO), the keyboard's init hooks
+    flash_sim_reset();
+    keymap_config.nkro = true;
+    default_layer_state = 1;
+    sim_advance(HARNESS_CYCLES_PER_MS);
+    matrix_init_user();
+    keyboard_post_init_kb();
+
+    start_ns = host_ns();
+    for (int n = 0; n < repeats; n++) {
+        for (int i = optind; i < argc; i++) {
+            end = sim_cycles;
+            replay(argv[i], &end);
+            //Whatever the trace left queued finishes, and a pending settings commit goes out
+            main_loop_until(end + HARNESS_SETTLE_MS * (uint64_t)HARNESS_CYCLES_PER_MS);
+            report_stuck();
+        }
+        if (n == 0 && !quiet) {
+            fwrite(text, 1, text_length, stdout);
+        }
+    }
+
+    fprintf(stderr, "%u events, %u reports, %u glyphs, %u other keys, %u LED on/off\n", stats.events, stats.reports,
+        unicode_queue_stats.glyphs, stats.other_keys, stats.led_changes);
+    fprintf(stderr, "unicode queue: %u key events deferred, %u presses dropped, %u glyphs dropped\n",
+        unicode_queue_stats.deferred, unicode_queue_stats.overflows, unicode_queue_stats.dropped);
+    fprintf(stderr, "settings log: %u records, %u unchanged, %u flash writes, %u erases\n", settings_log_stats.writes,
+        settings_log_stats.unchanged, flash_sim_stats.writes, flash_sim_stats.erases);
+    fprintf(stderr, "record path on the board clock: avg %.1f us, max %.1f us\n",
+        stats.events ? (double)stats.record_cycles / stats.events / DWT_CYCLES_PER_US : 0,
+        (double)stats.record_cycles_max / DWT_CYCLES_PER_US);
+    fprintf(stderr, "record path on the host: %.0f events/sec, avg %.0f ns, max %lu ns", 
+        stats.host_ns ? stats.events * 1e9 / stats.host_ns : 0, stats.events ? (double)stats.host_ns / stats.events : 0,
+        (unsigned long)stats.host_ns_max);
+#ifdef __x86_64__
+    fprintf(stderr, ", avg %.0f TSC cycles", stats.events ? (double)stats.host_tsc / stats.events : 0);
+#endif
+    fprintf(stderr, "\nreplay: %.0f events/sec including the simulated main loop\n",
+        stats.events * 1e9 / (host_ns() - start_ns));
+    return 0;
+}
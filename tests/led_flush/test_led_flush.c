@@ -0,0 +1,280 @@
+//Frames go through led_flush.c's driver, its writes land in two simulated IS31FL3733s. After every frame the
+//drivers must hold the newest frame, and frames that change little must cost little on the bus.
+
+#include <assert.h>
+#include <stdlib.h>
+#include "quantum.h"
+#include "arm_atsam_protocol.h"
+#include "config_led_gen.h"
+#include "frame_budget.h"
+#include "led_anim.h"
+#include "led_flush.h"
+
+uint32_t timer_ms;
+Dmac mock_dmac;
+Sercom mock_sercom1;
+DmacDescriptor dmac_desc;
+issi3733_driver_t issidrv[ISSI3733_DRIVER_COUNT] = { { 0xA0 }, { 0xBE } };
+uint8_t gcr_actual;
+uint8_t gcr_actual_last;
+volatile uint8_t i2c_led_q_running;
+RGB led_buffer[ISSI3733_LED_COUNT];
+bool led_anim_breathing;
+
+void led_anim_limit_gcr(void) {}
+
+extern const rgb_matrix_driver_t __wrap_rgb_matrix_driver;
+
+static const uint8_t registers[ISSI3733_LED_COUNT][4] = LED_PWM_REGISTERS;
+
+//IS31FL3733: the command register (page select) is behind a write lock, the PWM registers are page 1
+typedef struct {
+    bool unlocked;
+    uint8_t page;
+    uint8_t gcr;
+    bool on;                //LED on/off registers (page 0) all set
+    uint8_t pwm[LED_FLUSH_PAGE_BYTES];
+    uint32_t stray;         //Writes that landed outside the PWM page
+} chip_t;
+
+static chip_t chips[ISSI3733_DRIVER_COUNT];
+static uint8_t gcr_queue;
+static uint8_t onoff_queue;
+static uint8_t idle_interval;
+static uint32_t bus_bytes;
+static uint32_t bus_writes;
+
+static void core_init(void) {
+    memset(chips, 0, sizeof(chips));
+}
+
+static void core_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    led_buffer[index] = (RGB){ r, g, b };
+}
+
+static void core_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < ISSI3733_LED_COUNT; i++) {
+        core_set_color(i, r, g, b);
+    }
+}
+
+const rgb_matrix_driver_t __real_rgb_matrix_driver = {
+    .init = core_init,
+    .set_color = core_set_color,
+    .set_color_all = core_set_color_all,
+};
+
+void frame_budget_idle(uint8_t interval) {
+    idle_interval = interval;
+}
+
+//The core's GCR command selects the function page and leaves it selected
+void mock_i2c_led_q_gcr(uint8_t drvid) {
+    gcr_queue |= 1 << drvid;
+}
+
+void mock_i2c_led_q_onoff(uint8_t drvid) {
+    onoff_queue |= 1 << drvid;
+}
+
+uint8_t i2c_led_q_isempty(void) {
+    return !gcr_queue && !onoff_queue && !i2c_led_q_running;
+}
+
+uint8_t i2c_led_q_run(void) {
+    if (i2c_led_q_running) {
+        return 0;
+    }
+    for (uint8_t drv = 0; drv < ISSI3733_DRIVER_COUNT; drv++) {
+        if (onoff_queue & (1 << drv)) {
+            chips[drv].page = 0;
+            chips[drv].on = true;
+        }
+        if (gcr_queue & (1 << drv)) {
+            chips[drv].page = 3;
+            chips[drv].gcr = gcr_actual;
+        }
+    }
+    gcr_queue = 0;
+    onoff_queue = 0;
+    return 1;
+}
+
+static void chip_write(uint8_t addr, const uint8_t *data, uint16_t length) {
+    chip_t *chip = NULL;
+
+    for (uint8_t drv = 0; drv < ISSI3733_DRIVER_COUNT; drv++) {
+        if (issidrv[drv].addr == addr) {
+            chip = &chips[drv];
+        }
+    }
+    assert(chip && length >= 2);
+
+    if (data[0] == 0xFE) {
+        chip->unlocked = data[1] == 0xC5;
+    } else if (data[0] == 0xFD) {
+        assert(chip->unlocked);
+        chip->page = data[1];
+        chip->unlocked = false;
+    } else if (chip->page != 1) {
+        chip->stray++;
+    } else {
+        assert(data[0] + length - 1 <= LED_FLUSH_PAGE_BYTES);
+        memcpy(&chip->pwm[data[0]], &data[1], length - 1);
+    }
+}
+
+//Finishes the write on the bus the way the core's DMAC_0_Handler does
+static bool bus_complete(void) {
+    uint32_t addr = SERCOM1->I2CM.ADDR.reg;
+    uint16_t length = dmac_desc.BTCNT.reg;
+
+    if (!DMAC->Channel[0].CHCTRLA.bit.ENABLE) {
+        return false;
+    }
+    assert((addr >> 16 & 0xFF) == length && (addr & 0x2000));
+    chip_write(addr & 0xFF, (const uint8_t *)(uintptr_t)(dmac_desc.SRCADDR.reg - length), length);
+    bus_bytes += 1 + length;
+    bus_writes++;
+
+    DMAC->Channel[0].CHCTRLA.bit.ENABLE = 0;
+    i2c_led_q_running = 0;
+    i2c_led_q_run();
+    return true;
+}
+
+//Main loop passes until the bus goes quiet
+static void drain(void) {
+    do {
+        led_flush_task();
+    } while (bus_complete());
+}
+
+static void frame(void) {
+    timer_ms += FRAME_BUDGET_INTERVAL_MIN;
+    __wrap_rgb_matrix_driver.flush();
+}
+
+static void check_chips(void) {
+    for (int i = 0; i < ISSI3733_LED_COUNT; i++) {
+        const chip_t *chip = &chips[registers[i][0]];
+
+        assert(chip->pwm[registers[i][1]] == led_buffer[i].r);
+        assert(chip->pwm[registers[i][2]] == led_buffer[i].g);
+        assert(chip->pwm[registers[i][3]] == led_buffer[i].b);
+    }
+    for (int drv = 0; drv < ISSI3733_DRIVER_COUNT; drv++) {
+        assert(chips[drv].on && chips[drv].stray == 0);
+    }
+}
+
+static uint32_t flush_and_count(void) {
+    uint32_t start = bus_bytes;
+
+    frame();
+    drain();
+    check_chips();
+    return bus_bytes - start;
+}
+
+static void random_frame(void) {
+    for (int i = 0; i < ISSI3733_LED_COUNT; i++) {
+        led_buffer[i] = (RGB){ rand(), rand(), rand() };
+    }
+}
+
+int main(void) {
+    const uint32_t full = ISSI3733_DRIVER_COUNT * (3 + 3 + 2 + LED_FLUSH_PAGE_BYTES);
+    uint32_t bytes;
+
+    srand(1);
+    timer_ms = 100000;
+    __wrap_rgb_matrix_driver.init();
+    assert(chips[0].on && chips[1].on);
+
+    //First frame rewrites every register, page selects included
+    random_frame();
+    bytes = flush_and_count();
+    assert(bytes == full);
+
+    //Nothing changed, nothing sent
+    bytes = flush_and_count();
+    assert(bytes == 0);
+
+    //One channel of one LED: page select and a single register
+    led_buffer[0].r ^= 0xFF;
+    bytes = flush_and_count();
+    assert(bytes == 3 + 3 + 3);
+
+    //A row of keys, well under a page
+    for (int i = 1; i <= 6; i++) {
+        led_buffer[i] = (RGB){ 1, 2, 3 };
+    }
+    bytes = flush_and_count();
+    printf("six LEDs: %u bytes, full pages %u\n", bytes, full);
+    assert(bytes < full / 4);
+
+    //GCR goes out between passes, the PWM page is selected again after it
+    gcr_actual = 100;
+    led_buffer[70].b ^= 0x55;
+    flush_and_count();
+    assert(chips[0].gcr == 100 && chips[1].gcr == 100 && gcr_actual_last == 100);
+
+    //A frame arriving while the last one is still on the bus: the drivers end up with the newer one
+    random_frame();
+    frame();
+    led_flush_task();
+    bus_complete();
+    led_flush_task();
+    random_frame();
+    frame();
+    drain();
+    check_chips();
+
+    //Unchanged frames stretch the frame interval
+    for (int i = 0; i <= LED_FLUSH_IDLE_FRAMES; i++) {
+        flush_and_count();
+    }
+    assert(idle_interval == FRAME_BUDGET_INTERVAL_MIN * 2);
+    led_flush_wake();
+    assert(idle_interval == 0);
+
+    //Every register is rewritten after LED_FLUSH_REFRESH, even when nothing changed
+    timer_ms += LED_FLUSH_REFRESH;
+    bytes = flush_and_count();
+    assert(bytes == full);
+
+    //A driver reset by the core gets its LEDs switched on and every register back on the next refresh
+    memset(&chips[1], 0, sizeof(chips[1]));
+    frame();
+    drain();
+    assert(!chips[1].on);
+    timer_ms += LED_FLUSH_REFRESH;
+    bytes = flush_and_count();
+    assert(bytes == full);
+
+    //Small changes per frame, the bus finishing at random points in between
+    bytes = 0;
+    for (int n = 0; n < 20000; n++) {
+        int led = rand() % ISSI3733_LED_COUNT;
+        uint32_t start = bus_bytes;
+
+        led_buffer[led].g = rand();
+        if (rand() % 50 == 0) {
+            gcr_actual = rand();
+        }
+        frame();
+        for (int steps = rand() % 6; steps; steps--) {
+            led_flush_task();
+            bus_complete();
+        }
+        bytes += bus_bytes - start;
+    }
+    drain();
+    check_chips();
+    printf("one LED per frame: %u bytes/frame on average\n", bytes / 20000);
+    assert(bytes / 20000 < full / 8);
+
+    printf("led_flush: ok\n");
+    return 0;
+}
@@ -0,0 +1,146 @@
+//led_power_model.c estimates synthetic frames: dark, full white, single channels, a gradient and random frames.
+//The weighted sum must match a per-LED reference for any channel weights, the estimate must follow the frame and
+//the GCR linearly, and a frame scaled by led_power_level must come back within the budget.
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "led_power_model.h"
+
+#define FULL_FRAME_UA       (ISSI3733_LED_COUNT * 3UL * LED_POWER_CHANNEL_UA)
+
+static uint32_t seed = 1;
+
+static uint8_t random_byte(void) {
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 24;
+}
+
+static void fill(pixel_frame_t *frame, uint8_t r, uint8_t g, uint8_t b) {
+    memset(frame, 0, sizeof(*frame));
+    for (uint8_t led = 0; led < ISSI3733_LED_COUNT; led++) {
+        pixel_set(frame, led, r, g, b);
+    }
+}
+
+static void fill_random(pixel_frame_t *frame) {
+    memset(frame, 0, sizeof(*frame));
+    for (uint8_t led = 0; led < ISSI3733_LED_COUNT; led++) {
+        pixel_set(frame, led, random_byte(), random_byte(), random_byte());
+    }
+}
+
+//Brightness ramp across the LEDs, the shape of a rainbow or gradient effect
+static void fill_gradient(pixel_frame_t *frame) {
+    memset(frame, 0, sizeof(*frame));
+    for (uint8_t led = 0; led < ISSI3733_LED_COUNT; led++) {
+        uint8_t level = led * 255 / (ISSI3733_LED_COUNT - 1);
+
+        pixel_set(frame, led, level, 255 - level, level / 2);
+    }
+}
+
+static uint32_t reference_sum(const pixel_frame_t *frame, uint8_t r, uint8_t g, uint8_t b) {
+    uint32_t sum = 0;
+
+    for (uint8_t led = 0; led < ISSI3733_LED_COUNT; led++) {
+        const uint8_t *pixel = &frame->byte[led * 3];
+
+        sum += pixel[0] * r + pixel[1] * g + pixel[2] * b;
+    }
+    return sum;
+}
+
+static void test_weighted_sum(void) {
+    static const uint8_t weights[][3] = { { 255, 255, 255 }, { 255, 180, 90 }, { 0, 0, 1 }, { 1, 0, 0 }, { 7, 200, 13 } };
+    pixel_frame_t frame;
+
+    for (uint8_t i = 0; i < 20; i++) {
+        fill_random(&frame);
+        for (uint8_t w = 0; w < sizeof(weights) / sizeof(weights[0]); w++) {
+            uint32_t expected = reference_sum(&frame, weights[w][0], weights[w][1], weights[w][2]);
+
+            assert(led_power_weighted_sum(&frame, weights[w][0], weights[w][1], weights[w][2]) == expected);
+            assert(led_power_weighted_sum_scalar(&frame, weights[w][0], weights[w][1], weights[w][2]) == expected);
+        }
+    }
+}
+
+static void test_estimate(void) {
+    pixel_frame_t frame;
+    uint32_t white, red, half;
+
+    fill(&frame, 0, 0, 0);
+    assert(led_power_estimate(&frame, 255) == 0);
+
+    fill(&frame, 255, 255, 255);
+    white = led_power_estimate(&frame, 255);
+    assert(white == FULL_FRAME_UA);
+    assert(led_power_estimate(&frame, 0) == 0);
+    //Linear in the GCR, within the rounding down
+    assert(led_power_estimate(&frame, 165) == FULL_FRAME_UA * 165 / 255);
+
+    //The channels draw the same, so one channel is a third of white
+    fill(&frame, 255, 0, 0);
+    red = led_power_estimate(&frame, 255);
+    assert(red == FULL_FRAME_UA / 3);
+    fill(&frame, 0, 0, 255);
+    assert(led_power_estimate(&frame, 255) == red);
+
+    fill(&frame, 128, 128, 128);
+    half = led_power_estimate(&frame, 255);
+    assert(half == (uint64_t)FULL_FRAME_UA * 128 / 255);
+
+    fill_gradient(&frame);
+    assert(led_power_estimate(&frame, 255) < white);
+    assert(led_power_estimate(&frame, 255) > red);
+}
+
+static void check_limit(pixel_frame_t *frame, uint8_t gcr, uint32_t budget_ua) {
+    uint32_t before = led_power_estimate(frame, gcr);
+    uint16_t level = led_power_level(before, budget_ua);
+    uint32_t estimate;
+
+    if (before <= budget_ua) {
+        assert(level == PIXEL_LEVEL_MAX);
+        return;
+    }
+    assert(level < PIXEL_LEVEL_MAX);
+    pixel_scale(frame, level);
+    estimate = led_power_estimate(frame, gcr);
+    assert(estimate <= budget_ua);
+    //Not dimmed much further than it has to be: one level step plus a step per channel of rounding
+    assert(estimate + before / PIXEL_LEVEL_MAX + FULL_FRAME_UA / 255 >= budget_ua);
+}
+
+static void test_limit(void) {
+    static const uint32_t budgets_ma[] = { 400, 250, 100, 1 };
+    pixel_frame_t frame;
+
+    for (uint8_t b = 0; b < sizeof(budgets_ma) / sizeof(budgets_ma[0]); b++) {
+        uint32_t budget_ua = budgets_ma[b] * 1000;
+
+        fill(&frame, 255, 255, 255);
+        check_limit(&frame, 255, budget_ua);
+        fill(&frame, 255, 255, 255);
+        check_limit(&frame, 165, budget_ua);
+        fill_gradient(&frame);
+        check_limit(&frame, 255, budget_ua);
+        for (uint8_t i = 0; i < 20; i++) {
+            fill_random(&frame);
+            check_limit(&frame, random_byte(), budget_ua);
+        }
+    }
+
+    //A dark frame always fits
+    fill(&frame, 0, 0, 0);
+    assert(led_power_level(led_power_estimate(&frame, 255), 0) == PIXEL_LEVEL_MAX);
+}
+
+int main(void) {
+    test_weighted_sum();
+    test_estimate();
+    test_limit();
+    printf("led_power: ok\n");
+    return 0;
+}
@@ -0,0 +1,237 @@
+//matrix.c and idle_power.c run a simulated main loop against a simulated key matrix: rows driven low pull the
+//columns of pressed keys low after a settling time that differs per column and is far longer than the row pin
+//takes to read back its own level, and columns take a while to recover once the row is released. Every key
+//change must reach the matrix on the next loop iteration in every power tier, held keys in the same column as
+//the new one included, both at the select delay floor and once the delay has been calibrated down.
+
+#include <assert.h>
+#include <stdio.h>
+#include "quantum.h"
+#include "matrix.h"
+#include "samd51j18a.h"
+#include "dwt.h"
+#include "idle_power.h"
+#include "matrix_scan.h"
+
+//Simulated board, in core cycles
+#define ROW_READBACK        12                          //A row pin reads back its own level
+#define COL_SETTLE(col)     (180u + 10u * (col))         //A selected row pulls a pressed key's column low
+#define COL_RECOVER         120                         //A column is back high after the row is released
+#define READ_CYCLES         4                           //Cost of a DWT or port access
+#define LOOP_CYCLES         (20 * DWT_CYCLES_PER_US)    //Rest of the main loop
+#define CYCLES_PER_MS       (DWT_CYCLES_PER_US * 1000)
+
+uint32_t timer_ms;
+CoreDebug_Type mock_core_debug;
+
+static const uint8_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const uint8_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+static uint64_t now;
+static DWT_Type dwt;
+static Port port;
+static bool pressed[MATRIX_ROWS][MATRIX_COLS];
+static uint64_t row_low_since[MATRIX_ROWS];     //0 while the row is high
+static uint64_t row_released[MATRIX_ROWS];      //When a row that had settled low went high again
+static matrix_row_t matrix[MATRIX_ROWS];
+static uint32_t loops;
+static uint8_t power_interval;
+
+void frame_budget_power(uint8_t interval) {
+    power_interval = interval;
+}
+
+static bool pin_out(uint8_t pin) {
+    return port.Group[pin >> 5].OUT.reg & (1UL << (pin & 0x1F));
+}
+
+//Works the set and clear registers in and recomputes IN for the current time
+static void sync(void) {
+    for (uint8_t g = 0; g < 2; g++) {
+        PortGroup *group = &port.Group[g];
+
+        group->OUT.reg = (group->OUT.reg | group->OUTSET.reg) & ~group->OUTCLR.reg;
+        group->DIR.reg = (group->DIR.reg | group->DIRSET.reg) & ~group->DIRCLR.reg;
+        group->OUTSET.reg = group->OUTCLR.reg = group->DIRSET.reg = group->DIRCLR.reg = 0;
+        group->IN.reg = 0xFFFFFFFF;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        uint8_t pin = row_pins[row];
+
+        if (!pin_out(pin) && !row_low_since[row]) {
+            row_low_since[row] = now;
+        } else if (pin_out(pin) && row_low_since[row]) {
+            row_released[row] = now - row_low_since[row] >= COL_SETTLE(0) ? now : 0;
+            row_low_since[row] = 0;
+        }
+        if (row_low_since[row] && now - row_low_since[row] >= ROW_READBACK) {
+            port.Group[pin >> 5].IN.reg &= ~(1UL << (pin & 0x1F));
+        }
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            bool pulled = row_low_since[row] ? now - row_low_since[row] >= COL_SETTLE(col)
+                                             : row_released[row] && now - row_released[row] < COL_RECOVER;
+
+            if (pressed[row][col] && pulled) {
+                port.Group[col_pins[col] >> 5].IN.reg &= ~(1UL << (col_pins[col] & 0x1F));
+            }
+        }
+    }
+}
+
+static void advance(uint64_t cycles) {
+    now += cycles;
+    dwt.CYCCNT = (uint32_t)now;
+    timer_ms = (uint32_t)(now / CYCLES_PER_MS);
+}
+
+DWT_Type *mock_dwt(void) {
+    advance(READ_CYCLES);
+    sync();
+    return &dwt;
+}
+
+Port *mock_port(void) {
+    advance(READ_CYCLES);
+    sync();
+    return &port;
+}
+
+static void loop(void) {
+    matrix_scan_custom(matrix);
+    idle_power_task();
+    advance(LOOP_CYCLES);
+    loops++;
+}
+
+//Idles with no change to the keys
+static void run_ms(uint32_t ms) {
+    uint64_t until = now + (uint64_t)ms * CYCLES_PER_MS;
+
+    while (now < until) {
+        loop();
+    }
+}
+
+static bool matrix_has(uint8_t row, uint8_t col) {
+    return matrix[row] & ((matrix_row_t)1 << col);
+}
+
+//Changes a key and returns the loop iterations until the matrix shows it
+static uint32_t set_key(uint8_t row, uint8_t col, bool down) {
+    uint32_t start = loops;
+
+    pressed[row][col] = down;
+    while (matrix_has(row, col) != down) {
+        loop();
+        assert(loops - start < 100000);
+    }
+    for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+            assert(matrix_has(r, c) == pressed[r][c]);
+        }
+    }
+    return loops - start;
+}
+
+//Cycles a full scan takes with nothing pressed
+static uint32_t scan_cycles(void) {
+    uint64_t start = now;
+
+    matrix_scan_custom(matrix);
+    return now - start;
+}
+
+static void enter_tier(uint32_t ms, uint8_t interval) {
+    //Jump ahead rather than loop through minutes of idling, the tiers only look at the clock
+    advance((uint64_t)ms * CYCLES_PER_MS);
+    loop();
+    assert(power_interval == interval);
+}
+
+static void timeline(void) {
+    uint32_t probes;
+
+    //Active tier: every loop scans in full
+    assert(set_key(1, 4, true) == 1);
+    assert(set_key(1, 4, false) == 1);
+
+    //Idle tier, nothing held: the probe loops see a press at once
+    enter_tier(IDLE_POWER_IDLE_MS, IDLE_POWER_IDLE_FRAME_MS);
+    probes = idle_power_stats.probes;
+    run_ms(20);
+    assert(idle_power_stats.probes > probes);
+    assert(set_key(2, 7, true) == 1);
+    assert(power_interval == 0);
+    assert(set_key(2, 7, false) == 1);
+
+    //Idle tier with a key held: a second key in the same column, then its release, then one in another column
+    assert(set_key(0, 3, true) == 1);
+    enter_tier(IDLE_POWER_IDLE_MS, IDLE_POWER_IDLE_FRAME_MS);
+    run_ms(20);
+    assert(set_key(2, 3, true) == 1);
+    enter_tier(IDLE_POWER_IDLE_MS, IDLE_POWER_IDLE_FRAME_MS);
+    assert(set_key(2, 3, false) == 1);
+    enter_tier(IDLE_POWER_IDLE_MS, IDLE_POWER_IDLE_FRAME_MS);
+    assert(set_key(4, 12, true) == 1);
+    assert(set_key(4, 12, false) == 1);
+    assert(set_key(0, 3, false) == 1);
+
+    //Deep tier: the same with two keys on one row and column
+    enter_tier(IDLE_POWER_DEEP_MS, IDLE_POWER_DEEP_FRAME_MS);
+    assert(set_key(3, 10, true) == 1);
+    enter_tier(IDLE_POWER_DEEP_MS, IDLE_POWER_DEEP_FRAME_MS);
+    assert(set_key(3, 11, true) == 1);
+    enter_tier(IDLE_POWER_DEEP_MS, IDLE_POWER_DEEP_FRAME_MS);
+    assert(set_key(1, 10, true) == 1);
+    enter_tier(IDLE_POWER_DEEP_MS, IDLE_POWER_DEEP_FRAME_MS);
+    assert(set_key(3, 10, false) == 1);
+    assert(set_key(3, 11, false) == 1);
+    assert(set_key(1, 10, false) == 1);
+
+    //Back to probing once everything is up
+    enter_tier(IDLE_POWER_DEEP_MS, IDLE_POWER_DEEP_FRAME_MS);
+    probes = idle_power_stats.probes;
+    run_ms(50);
+    assert(idle_power_stats.probes > probes);
+}
+
+int main(void) {
+    uint32_t floor_scan, calibrated_scan;
+
+    advance(CYCLES_PER_MS);
+    sync();
+    matrix_init_custom();
+    run_ms(10);
+
+    //Nothing timed yet: rows are read after the floor
+    assert(matrix_select_delay == MATRIX_SELECT_FLOOR_US * DWT_CYCLES_PER_US);
+    floor_scan = scan_cycles();
+    assert(set_key(3, 14, true) == 1);
+    assert(set_key(3, 14, false) == 1);
+    assert(matrix_scan_stats.samples < MATRIX_SELECT_SAMPLES);
+
+    //Holding a key in the fastest column times its transitions, the delay comes down to twice the slowest
+    pressed[2][0] = true;
+    run_ms(10);
+    assert(matrix_scan_stats.samples >= MATRIX_SELECT_SAMPLES);
+    assert(matrix_scan_stats.slowest >= COL_SETTLE(0));
+    assert(matrix_select_delay >= 2 * COL_SETTLE(0) && matrix_select_delay < MATRIX_SELECT_FLOOR_US * DWT_CYCLES_PER_US / 4);
+    set_key(2, 0, false);
+
+    //The columns that were never timed are slower still, but within the doubled delay
+    calibrated_scan = scan_cycles();
+    timeline();
+    assert(matrix_select_delay < 2 * COL_SETTLE(MATRIX_COLS) + MATRIX_SELECT_FLOOR_US * DWT_CYCLES_PER_US / 8);
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        assert(set_key(col % MATRIX_ROWS, col, true) == 1);
+        assert(set_key(col % MATRIX_ROWS, col, false) == 1);
+    }
+
+    printf("full scan: %.1f us at the floor, %.1f us calibrated (select delay %.2f us)\n",
+        (double)floor_scan / DWT_CYCLES_PER_US, (double)calibrated_scan / DWT_CYCLES_PER_US,
+        (double)matrix_select_delay / DWT_CYCLES_PER_US);
+    printf("matrix: ok\n");
+    return 0;
+}
@@ -0,0 +1,145 @@
+//The settings log on a simulated flash: every read after a reboot must return the newest snapshot that fully
+//made it to flash, through block wraparound, records and erases torn by a power loss and corrupted records.
+//settings_log.c is included so a reboot can drop its RAM state.
+
+#include <assert.h>
+#include <stdio.h>
+#include "flash_sim.h"
+#include "../../settings_log.c"
+
+typedef struct {
+    uint32_t count;
+    uint8_t fill[12];
+} settings_t;
+
+static void reboot(void) {
+    memset(&settings_log, 0, sizeof(settings_log));
+    flash_sim_power_on();
+}
+
+static bool save(uint32_t count) {
+    settings_t settings = { .count = count };
+
+    memset(settings.fill, count, sizeof(settings.fill));
+    return settings_log_write(&settings, sizeof(settings), 1);
+}
+
+//The snapshot read back after a reboot, 0 for none
+static uint32_t saved(void) {
+    settings_t settings;
+    uint8_t version;
+
+    reboot();
+    if (!settings_log_read(&settings, sizeof(settings), &version)) {
+        return 0;
+    }
+    assert(version == 1);
+    for (uint8_t i = 0; i < sizeof(settings.fill); i++) {
+        assert(settings.fill[i] == (uint8_t)settings.count);
+    }
+    return settings.count;
+}
+
+static void start(void) {
+    flash_sim_reset();
+    settings_log_stats = (settings_log_stats_t){ 0 };
+    reboot();
+}
+
+int main(void) {
+    uint32_t count;
+
+    //Blank flash, then a record read back, then an identical snapshot costing nothing
+    start();
+    assert(saved() == 0);
+    assert(save(1) && saved() == 1);
+    assert(save(1) && settings_log_stats.unchanged == 1 && flash_sim_stats.writes == 1);
+
+    //Wraparound: three times round both blocks, a reboot after every write must find the newest record
+    start();
+    for (count = 1; count <= SETTINGS_LOG_SLOTS * SETTINGS_LOG_BLOCKS * 3; count++) {
+        assert(save(count));
+        if (count % 37 == 0 || count % SETTINGS_LOG_SLOTS <= 1) {
+            assert(saved() == count);
+        }
+    }
+    assert(saved() == count - 1);
+    assert(settings_log_stats.errors == 0);
+    assert(flash_sim_stats.erases == SETTINGS_LOG_BLOCKS * 3 - 1);
+
+    //Torn record: power lost part way through every possible byte of a write, the previous record survives
+    //and the next write goes to a clean slot
+    for (int32_t torn = 0; torn < SETTINGS_LOG_RECORD_SIZE; torn++) {
+        start();
+        assert(save(1) && save(2));
+        flash_sim_power_left = torn;
+        assert(!save(3));
+        assert(saved() == 2);
+        assert(save(4) && saved() == 4);
+        assert(save(5) && saved() == 5);
+    }
+
+    //Torn erase: the block being recycled is partly erased when the power goes, the full block still holds the
+    //newest record and the erase is done again on the next write
+    for (int32_t torn = 0; torn < SETTINGS_FLASH_BLOCK_SIZE; torn += SETTINGS_FLASH_BLOCK_SIZE / 8 - 40) {
+        start();
+        for (count = 1; count <= SETTINGS_LOG_SLOTS * SETTINGS_LOG_BLOCKS; count++) {
+            assert(save(count));
+        }
+        flash_sim_power_left = torn;
+        assert(!save(count));
+        assert(saved() == count - 1);
+        assert(save(count + 1) && saved() == count + 1);
+    }
+
+    //CRC mismatch: a flipped bit in the newest record falls back to the one before it
+    start();
+    assert(save(1) && save(2) && save(3));
+    flash_sim[2 * SETTINGS_LOG_RECORD_SIZE + offsetof(settings_record_t, payload) + 5] ^= 0x10;
+    assert(saved() == 2);
+    //The bad record's slot is not reused
+    assert(save(6) && saved() == 6);
+    assert(settings_log.next == 4);
+    //A valid record with a wrong magic byte is not taken either
+    flash_sim[3 * SETTINGS_LOG_RECORD_SIZE] = 0x00;
+    assert(saved() == 2);
+
+    //Migration: a record written by an older build with a smaller struct and older version is read back zero
+    //padded with its version, so the caller can convert it
+    start();
+    {
+        uint16_t old_settings = 0xBEEF;
+        settings_t settings;
+        uint8_t version;
+
+        assert(settings_log_write(&old_settings, sizeof(old_settings), 0));
+        reboot();
+        memset(&settings, 0xAA, sizeof(settings));
+        assert(settings_log_read(&settings, sizeof(settings), &version));
+        assert(version == 0 && settings.count == 0xBEEF && settings.fill[0] == 0 && settings.fill[11] == 0);
+        //The converted snapshot is a change even with equal bytes, since the version differs
+        settings = (settings_t){ .count = 0xBEEF };
+        assert(settings_log_write(&settings, sizeof(settings), 1) && settings_log_stats.unchanged == 0);
+        assert(settings_log_read(&settings, sizeof(settings), &version) && version == 1);
+    }
+
+    //Payloads that do not fit a record are refused without touching flash
+    {
+        uint8_t big[SETTINGS_LOG_PAYLOAD_SIZE + 1] = { 0 };
+
+        start();
+        assert(!settings_log_write(big, sizeof(big), 1) && flash_sim_stats.writes == 0);
+    }
+
+    //SmartEEPROM fuses reserving enough of the end of flash to reach the log: the log stays off
+    start();
+    assert(save(1));
+    flash_sim_smarteeprom_blocks = 2;
+    assert(saved() == 0 && !save(2));
+    assert(settings_log_stats.refused == 2 && flash_sim_stats.writes == 1);
+    flash_sim_smarteeprom_blocks = 1;
+    assert(saved() == 1);
+
+    printf("settings_log: ok\n");
+    return 0;
+}
@@ -0,0 +1,330 @@
+//sr_shadow.c runs against a simulated SERCOM2 in SPI mode feeding a 16-bit shift register latched by RCLK, with
+//interrupts that can come in at any register access while PRIMASK is clear. Each byte takes a few accesses to
+//shift out. Every value the register latches is logged, and the log must hold each batch and each step of a
+//sequence in program order, the core's own polled writes (SR_EXP_WriteData, wrapped) included, whether they come
+//with interrupts on or off.
+
+#include <assert.h>
+#include <stdio.h>
+#include "quantum.h"
+#include "arm_atsam_protocol.h"
+#include "sr_shadow.h"
+
+#define BYTE_ACCESSES       3               //Register accesses it takes to shift one byte out
+#define ACCESS_LIMIT        100000          //Accesses a wait may take before it counts as hung
+//Bits the mock keeps in the registers it reads back, so a write by the code under test shows up as their absence
+#define DATA_IDLE           0x100
+#define FLAG_IDLE           0x80
+
+Srdata_t sr_exp_data;
+
+static Sercom sercom;
+static Port port;
+
+//SERCOM2: the data register empty flag drops while a byte waits behind the one shifting
+static uint8_t flags = SERCOM_SPI_INTFLAG_DRE;
+static uint8_t inten;
+static bool buffered;
+static uint8_t buffer;
+static bool busy;
+static uint8_t shifter;
+static uint8_t shift_left;
+static uint16_t shift_register;
+
+//NVIC: pending stays latched until the handler runs or it is cleared, as on the core
+static bool enabled[2];
+static bool pending[2];
+static uint32_t primask;
+static bool in_handler;
+static uint32_t accesses;
+
+static uint16_t latched[64];
+static uint8_t latches;
+static bool rclk;
+
+static void data_write(uint8_t data) {
+    assert(flags & SERCOM_SPI_INTFLAG_DRE);
+    flags &= ~SERCOM_SPI_INTFLAG_TXC;
+    if (!busy) {
+        shifter = data;
+        busy = true;
+        shift_left = BYTE_ACCESSES;
+    } else {
+        buffer = data;
+        buffered = true;
+        flags &= ~SERCOM_SPI_INTFLAG_DRE;
+    }
+}
+
+//Works the last access's writes into the register state
+static void fold(void) {
+    PortGroup *group = &port.Group[SR_EXP_RCLK_PORT];
+    bool level;
+
+    if (sercom.SPI.DATA.reg != DATA_IDLE) {
+        data_write(sercom.SPI.DATA.reg);
+    }
+    if (!(sercom.SPI.INTENSET.reg & FLAG_IDLE)) {
+        inten |= sercom.SPI.INTENSET.reg;
+    }
+    if (!(sercom.SPI.INTENCLR.reg & FLAG_IDLE)) {
+        inten &= ~sercom.SPI.INTENCLR.reg;
+    }
+    if (!(sercom.SPI.INTFLAG.reg & FLAG_IDLE)) {
+        flags &= ~(sercom.SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_TXC);
+    }
+
+    group->OUT.reg = (group->OUT.reg | group->OUTSET.reg) & ~group->OUTCLR.reg;
+    group->OUTSET.reg = group->OUTCLR.reg = 0;
+    level = group->OUT.reg & (1UL << SR_EXP_RCLK_PIN);
+    if (level && !rclk) {
+        assert(latches < sizeof(latched) / sizeof(latched[0]));
+        latched[latches++] = shift_register;
+    }
+    rclk = level;
+}
+
+static void publish(void) {
+    sercom.SPI.DATA.reg = DATA_IDLE;
+    sercom.SPI.INTENSET.reg = inten | FLAG_IDLE;
+    sercom.SPI.INTENCLR.reg = FLAG_IDLE;
+    sercom.SPI.INTFLAG.reg = flags | FLAG_IDLE;
+}
+
+static void tick(void) {
+    if (!busy || --shift_left) {
+        return;
+    }
+    //The low byte goes out first and ends up in the far half, as with the core's writes
+    shift_register = (shift_register >> 8) | (uint16_t)shifter << 8;
+    busy = false;
+    if (buffered) {
+        shifter = buffer;
+        buffered = false;
+        busy = true;
+        shift_left = BYTE_ACCESSES;
+        flags |= SERCOM_SPI_INTFLAG_DRE;
+    } else {
+        flags |= SERCOM_SPI_INTFLAG_TXC;
+    }
+}
+
+//A level interrupt goes pending while its line is up, but only again once the handler it runs has returned
+static void raise(void) {
+    if (flags & inten & SERCOM_SPI_INTFLAG_DRE) {
+        pending[0] = true;
+    }
+    if (flags & inten & SERCOM_SPI_INTFLAG_TXC) {
+        pending[1] = true;
+    }
+}
+
+static void dispatch(void) {
+    if (primask || in_handler) {
+        return;
+    }
+    in_handler = true;
+    for (uint8_t line = 0; line < 2; line++) {
+        if (enabled[line] && pending[line]) {
+            pending[line] = false;
+            if (line == 0) {
+                SERCOM2_0_Handler();
+            } else {
+                SERCOM2_1_Handler();
+            }
+            fold();
+            publish();
+            raise();
+        }
+    }
+    in_handler = false;
+}
+
+Sercom *mock_sercom2(void) {
+    assert(++accesses < ACCESS_LIMIT);
+    fold();
+    tick();
+    publish();
+    if (!in_handler) {
+        raise();
+    }
+    dispatch();
+    return &sercom;
+}
+
+Port *mock_port(void) {
+    fold();
+    return &port;
+}
+
+void __disable_irq(void) {
+    primask = 1;
+}
+
+void __enable_irq(void) {
+    primask = 0;
+    dispatch();
+}
+
+uint32_t __get_PRIMASK(void) {
+    return primask;
+}
+
+void __set_PRIMASK(uint32_t value) {
+    primask = value;
+    dispatch();
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq) {
+    enabled[irq - SERCOM2_0_IRQn] = true;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq) {
+    pending[irq - SERCOM2_0_IRQn] = false;
+}
+
+//The core's polled write, as in spi_master.c
+void __real_SR_EXP_WriteData(void) {
+    SR_EXP_RCLK_LO;
+    while (!(SR_EXP_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_DRE)) {}
+    SR_EXP_SERCOM->SPI.DATA.reg = sr_exp_data.reg & 0xFF;
+    while (!(SR_EXP_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_DRE)) {}
+    SR_EXP_SERCOM->SPI.DATA.reg = sr_exp_data.reg >> 8;
+    while (!(SR_EXP_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_TXC)) {}
+    SR_EXP_RCLK_HI;
+}
+
+void __wrap_SR_EXP_WriteData(void);
+
+//The main loop going on with other work while the interrupts shift the queue out
+static void run(void) {
+    accesses = 0;
+    while (sr_shadow_busy()) {
+        (void)mock_sercom2();
+    }
+    (void)mock_sercom2();
+    fold();
+}
+
+static void expect(const uint16_t *values, uint8_t count) {
+    assert(latches == count);
+    for (uint8_t i = 0; i < count; i++) {
+        assert(latched[i] == values[i]);
+    }
+    assert(!busy && !buffered);
+}
+
+int main(void) {
+    publish();
+    sr_exp_data.reg = 0x4100;
+    sr_shadow_init();
+
+    //Changes to different bits in one pass go out as one write
+    sr_shadow_write(0x0001, 0x0001);
+    sr_shadow_write(0x0002, 0x0002);
+    sr_shadow_write(0x8000, 0x8000);
+    sr_shadow_flush();
+    run();
+    expect((const uint16_t[]){ 0xC103 }, 1);
+
+    //A pulse on one bit keeps every step
+    sr_shadow_write(0x0010, 0x0010);
+    sr_shadow_write(0x0010, 0x0000);
+    sr_shadow_write(0x0010, 0x0010);
+    sr_shadow_flush();
+    run();
+    expect((const uint16_t[]){ 0xC103, 0xC113, 0xC103, 0xC113 }, 4);
+
+    //Order across bits when asked for
+    sr_shadow_write(0x0020, 0x0020);
+    sr_shadow_commit();
+    sr_shadow_write(0x0040, 0x0040);
+    sr_shadow_flush();
+    run();
+    expect((const uint16_t[]){ 0xC103, 0xC113, 0xC103, 0xC113, 0xC133, 0xC173 }, 6);
+
+    //No net change, no write
+    sr_shadow_write(0x0001, 0x0001);
+    sr_shadow_flush();
+    run();
+    assert(latches == 6);
+
+    //More steps than the queue holds, the stall drains it in place
+    latches = 0;
+    for (uint8_t i = 0; i < 20; i++) {
+        sr_shadow_write(0x0200, i & 1 ? 0 : 0x0200);
+    }
+    sr_shadow_flush();
+    run();
+    assert(latches == 20);
+    for (uint8_t i = 0; i < 20; i++) {
+        assert(latched[i] == (i & 1 ? 0xC173 : 0xC373));
+    }
+    assert(sr_shadow_stats.stalls);
+
+    //The core's write lands after everything queued before it, and the open batch goes out first, without the
+    //core's change. Interrupts are on, one value is still shifting out when it comes in.
+    latches = 0;
+    sr_shadow_write(0x0004, 0x0004);
+    sr_shadow_commit();
+    sr_shadow_write(0x0008, 0x0008);
+    sr_shadow_commit();
+    sr_shadow_write(0x0400, 0x0400);
+    sr_shadow_flush();
+    (void)mock_sercom2();
+    assert(sr_shadow_busy() && latches == 0);
+    sr_shadow_write(0x0800, 0x0800);
+    sr_exp_data.bit.HUB_RESET_N = 0;
+    accesses = 0;
+    __wrap_SR_EXP_WriteData();
+    fold();
+    expect((const uint16_t[]){ 0xC177, 0xC17F, 0xC57F, 0xCD7F, 0x8D7F }, 5);
+    assert(!sr_shadow_busy());
+
+    //Same with interrupts off: the wait runs the handlers itself, leaves PRIMASK as it was and no handler
+    //runs for what it already did once interrupts are back on
+    latches = 0;
+    sr_shadow_write(0x0004, 0x0000);
+    sr_shadow_commit();
+    sr_shadow_write(0x0008, 0x0000);
+    sr_shadow_flush();
+    (void)mock_sercom2();
+    __disable_irq();
+    sr_exp_data.bit.HUB_RESET_N = 1;
+    accesses = 0;
+    __wrap_SR_EXP_WriteData();
+    assert(primask == 1);
+    __enable_irq();
+    run();
+    expect((const uint16_t[]){ 0x8D7B, 0x8D73, 0xCD73 }, 3);
+    assert(!pending[0] && !pending[1] && !inten);
+
+    //The core changes a bit the open batch changed the other way: the batch goes out first and the core's
+    //value ends up on the pins, as in program order
+    latches = 0;
+    sr_shadow_write(0x0008, 0x0008);
+    sr_shadow_flush();
+    run();
+    sr_shadow_write(0x0008, 0x0000);
+    sr_exp_data.bit.SDB_N = 1;
+    __wrap_SR_EXP_WriteData();
+    fold();
+    expect((const uint16_t[]){ 0xCD7B, 0xCD73, 0xCD7B }, 3);
+    assert(sr_exp_data.reg == 0xCD7B);
+    //Later batches build on the core's value
+    sr_shadow_write(0x0004, 0x0004);
+    sr_shadow_flush();
+    run();
+    expect((const uint16_t[]){ 0xCD7B, 0xCD73, 0xCD7B, 0xCD7F }, 4);
+
+    //A core write with nothing queued goes straight out
+    latches = 0;
+    sr_exp_data.bit.SDB_N = 0;
+    __wrap_SR_EXP_WriteData();
+    fold();
+    expect((const uint16_t[]){ 0xCD77 }, 1);
+
+    sr_shadow_print();
+    printf("sr_shadow: ok\n");
+    return 0;
+}
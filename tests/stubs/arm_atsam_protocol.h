@@ -0,0 +1,9 @@
+//Host stand-in for the arm_atsam core's arm_atsam_protocol.h
+
+#pragma once
+
+#include "samd51j18a.h"
+#include "md_rgb_matrix.h"
+#include "i2c_master.h"
+#include "usb/usb2422.h"
+#include "spi_master.h"
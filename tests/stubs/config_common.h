@@ -0,0 +1,68 @@
+//Host stand-in for QMK's config_common.h, the pin names config.h lists (group * 32 + pin, as on the ATSAM)
+
+#pragma once
+
+#define A00 0
+#define A01 1
+#define A02 2
+#define A03 3
+#define A04 4
+#define A05 5
+#define A06 6
+#define A07 7
+#define A08 8
+#define A09 9
+#define A10 10
+#define A11 11
+#define A12 12
+#define A13 13
+#define A14 14
+#define A15 15
+#define A16 16
+#define A17 17
+#define A18 18
+#define A19 19
+#define A20 20
+#define A21 21
+#define A22 22
+#define A23 23
+#define A24 24
+#define A25 25
+#define A26 26
+#define A27 27
+#define A28 28
+#define A29 29
+#define A30 30
+#define A31 31
+#define B00 32
+#define B01 33
+#define B02 34
+#define B03 35
+#define B04 36
+#define B05 37
+#define B06 38
+#define B07 39
+#define B08 40
+#define B09 41
+#define B10 42
+#define B11 43
+#define B12 44
+#define B13 45
+#define B14 46
+#define B15 47
+#define B16 48
+#define B17 49
+#define B18 50
+#define B19 51
+#define B20 52
+#define B21 53
+#define B22 54
+#define B23 55
+#define B24 56
+#define B25 57
+#define B26 58
+#define B27 59
+#define B28 60
+#define B29 61
+#define B30 62
+#define B31 63
@@ -0,0 +1,92 @@
+#include "flash_sim.h"
+
+#include <assert.h>
+#include <string.h>
+
+uint8_t flash_sim[FLASH_SIM_SIZE];
+flash_sim_stats_t flash_sim_stats;
+int32_t flash_sim_power_left = -1;
+uint8_t flash_sim_smarteeprom_blocks = 1;
+
+static bool programmed[FLASH_SIM_SIZE / SETTINGS_FLASH_WRITE_SIZE];
+static bool power_lost;
+
+static uint32_t offset(uint32_t addr, uint32_t size) {
+    assert(addr >= FLASH_SIM_BASE && addr - FLASH_SIM_BASE + size <= FLASH_SIM_SIZE);
+    return addr - FLASH_SIM_BASE;
+}
+
+//Bytes of an operation of the given size that happen before the power goes
+static uint32_t power_for(uint32_t size) {
+    if (flash_sim_power_left < 0) {
+        return size;
+    }
+    if ((uint32_t)flash_sim_power_left >= size) {
+        flash_sim_power_left -= size;
+        return size;
+    }
+    size = flash_sim_power_left;
+    flash_sim_power_left = 0;
+    power_lost = true;
+    return size;
+}
+
+void flash_sim_reset(void) {
+    memset(flash_sim, 0xFF, sizeof(flash_sim));
+    memset(programmed, 0, sizeof(programmed));
+    flash_sim_stats = (flash_sim_stats_t){ 0 };
+    flash_sim_smarteeprom_blocks = 1;
+    flash_sim_power_on();
+}
+
+void flash_sim_power_on(void) {
+    flash_sim_power_left = -1;
+    power_lost = false;
+}
+
+void settings_flash_read(uint32_t addr, void *data, uint32_t size) {
+    memcpy(data, &flash_sim[offset(addr, size)], size);
+}
+
+bool settings_flash_write(uint32_t addr, const void *data, uint32_t size) {
+    uint32_t at = offset(addr, size);
+    const uint8_t *byte = data;
+    uint32_t done;
+
+    assert(at % SETTINGS_FLASH_WRITE_SIZE == 0 && size % SETTINGS_FLASH_WRITE_SIZE == 0);
+    if (power_lost) {
+        return false;
+    }
+    for (uint32_t i = at / SETTINGS_FLASH_WRITE_SIZE; i < (at + size) / SETTINGS_FLASH_WRITE_SIZE; i++) {
+        assert(!programmed[i]);
+    }
+
+    done = power_for(size);
+    for (uint32_t i = 0; i < done; i++) {
+        flash_sim[at + i] &= byte[i];
+        programmed[(at + i) / SETTINGS_FLASH_WRITE_SIZE] = true;
+    }
+    flash_sim_stats.writes++;
+    flash_sim_stats.bytes += done;
+    return done == size;
+}
+
+bool settings_flash_erase(uint32_t addr) {
+    uint32_t at = offset(addr, SETTINGS_FLASH_BLOCK_SIZE);
+    uint32_t done;
+
+    assert(at % SETTINGS_FLASH_BLOCK_SIZE == 0);
+    if (power_lost) {
+        return false;
+    }
+    done = power_for(SETTINGS_FLASH_BLOCK_SIZE);
+    memset(&flash_sim[at], 0xFF, done);
+    memset(&programmed[at / SETTINGS_FLASH_WRITE_SIZE], 0, done / SETTINGS_FLASH_WRITE_SIZE);
+    flash_sim_stats.erases++;
+    return done == SETTINGS_FLASH_BLOCK_SIZE;
+}
+
+//SAMD51J18A: 256 KB of flash
+bool settings_flash_usable(uint32_t addr, uint32_t size) {
+    return addr + size <= 0x40000 - 2 * (uint32_t)flash_sim_smarteeprom_blocks * SETTINGS_FLASH_BLOCK_SIZE;
+}
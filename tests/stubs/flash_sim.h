@@ -0,0 +1,31 @@
+//Simulated NOR flash behind settings_flash.h, covering the settings log's blocks
+//Programming can only clear bits and each quad-word only once per erase, like the SAMD51's NVM with ECC.
+//A power loss can be injected part way through a write or an erase.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "settings_flash.h"
+#include "settings_log.h"
+
+#define FLASH_SIM_BASE SETTINGS_LOG_ADDR
+#define FLASH_SIM_SIZE (SETTINGS_LOG_BLOCKS * SETTINGS_FLASH_BLOCK_SIZE)
+
+typedef struct {
+    uint32_t writes;
+    uint32_t erases;
+    uint32_t bytes;         //Bytes programmed
+} flash_sim_stats_t;
+
+extern uint8_t flash_sim[FLASH_SIM_SIZE];
+extern flash_sim_stats_t flash_sim_stats;
+//SmartEEPROM blocks per bank the simulated fuses reserve at the end of flash (SEESTAT.SBLK), 1 after a reset
+extern uint8_t flash_sim_smarteeprom_blocks;
+//Bytes still programmed (or erased) before power is lost, -1 for never. Every later call fails until flash_sim_power_on.
+extern int32_t flash_sim_power_left;
+
+//Erases everything, as shipped
+void flash_sim_reset(void);
+//Back after a power loss: the flash keeps what made it, the program state is up to the test
+void flash_sim_power_on(void);
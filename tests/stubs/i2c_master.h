@@ -0,0 +1,17 @@
+//Host stand-in for the arm_atsam core's i2c_master.h, the LED queue the keyboard shares with it
+
+#pragma once
+
+#include <stdint.h>
+
+extern volatile uint8_t i2c_led_q_running;
+
+uint8_t i2c_led_q_isempty(void);
+uint8_t i2c_led_q_run(void);
+void I2C3733_Control_Set(uint8_t state);
+//Queues a GCR write to a driver
+void mock_i2c_led_q_gcr(uint8_t drvid);
+#define I2C_LED_Q_GCR(n) mock_i2c_led_q_gcr(n)
+//Queues a write of the LED on/off registers (page 0) to a driver
+void mock_i2c_led_q_onoff(uint8_t drvid);
+#define I2C_LED_Q_ONOFF(n) mock_i2c_led_q_onoff(n)
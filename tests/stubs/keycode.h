@@ -0,0 +1,67 @@
+//Host stand-in for QMK's keycode.h and quantum_keycodes.h, the codes the keymap uses with their QMK values
+
+#pragma once
+
+#define MOD_BIT(code) (1 << ((code) & 0x07))
+
+enum hid_keyboard_keypad_usage {
+    KC_NO = 0x00,
+    KC_TRANSPARENT = 0x01,
+    KC_A = 0x04, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M,
+    KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z,
+    KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0,
+    KC_ENTER, KC_ESCAPE, KC_BSPACE, KC_TAB, KC_SPACE, KC_MINUS, KC_EQUAL, KC_LBRACKET, KC_RBRACKET,
+    KC_BSLASH, KC_NONUS_HASH, KC_SCOLON, KC_QUOTE, KC_GRAVE, KC_COMMA, KC_DOT, KC_SLASH, KC_CAPSLOCK,
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12,
+    KC_PSCREEN, KC_SCROLLLOCK, KC_PAUSE, KC_INSERT, KC_HOME, KC_PGUP, KC_DELETE, KC_END, KC_PGDOWN,
+    KC_RIGHT, KC_LEFT, KC_DOWN, KC_UP,
+    KC_AUDIO_MUTE = 0xA8, KC_AUDIO_VOL_UP, KC_AUDIO_VOL_DOWN,
+    KC_LCTRL = 0xE0, KC_LSHIFT, KC_LALT, KC_LGUI, KC_RCTRL, KC_RSHIFT, KC_RALT, KC_RGUI,
+};
+
+#define KC_TRNS KC_TRANSPARENT
+#define _______ KC_TRNS
+#define KC_ENT KC_ENTER
+#define KC_ESC KC_ESCAPE
+#define KC_BSPC KC_BSPACE
+#define KC_SPC KC_SPACE
+#define KC_MINS KC_MINUS
+#define KC_EQL KC_EQUAL
+#define KC_LBRC KC_LBRACKET
+#define KC_RBRC KC_RBRACKET
+#define KC_BSLS KC_BSLASH
+#define KC_SCLN KC_SCOLON
+#define KC_QUOT KC_QUOTE
+#define KC_GRV KC_GRAVE
+#define KC_COMM KC_COMMA
+#define KC_SLSH KC_SLASH
+#define KC_CAPS KC_CAPSLOCK
+#define KC_PSCR KC_PSCREEN
+#define KC_SLCK KC_SCROLLLOCK
+#define KC_PAUS KC_PAUSE
+#define KC_DEL KC_DELETE
+#define KC_PGDN KC_PGDOWN
+#define KC_RGHT KC_RIGHT
+#define KC_MUTE KC_AUDIO_MUTE
+#define KC_VOLU KC_AUDIO_VOL_UP
+#define KC_VOLD KC_AUDIO_VOL_DOWN
+#define KC_LCTL KC_LCTRL
+#define KC_LSFT KC_LSHIFT
+#define KC_RCTL KC_RCTRL
+#define KC_RSFT KC_RSHIFT
+
+enum quantum_keycodes {
+    QK_BASIC_MAX = 0x00FF,
+    QK_MOMENTARY = 0x5100,
+    QK_TOGGLE_LAYER = 0x5300,
+    QK_ONE_SHOT_LAYER = 0x5400,
+    MAGIC_TOGGLE_NKRO = 0x5C14,
+    SAFE_RANGE = 0x5DAA,
+    QK_UNICODEMAP = 0x8000,
+    QK_UNICODEMAP_PAIR = 0xC000,
+};
+
+#define MO(layer) (QK_MOMENTARY | ((layer) & 0xFF))
+#define TG(layer) (QK_TOGGLE_LAYER | ((layer) & 0xFF))
+#define OSL(layer) (QK_ONE_SHOT_LAYER | ((layer) & 0xFF))
+#define NK_TOGG MAGIC_TOGGLE_NKRO
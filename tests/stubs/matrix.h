@@ -0,0 +1,17 @@
+//Host stand-in for QMK's matrix.h
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if MATRIX_COLS <= 8
+typedef uint8_t matrix_row_t;
+#elif MATRIX_COLS <= 16
+typedef uint16_t matrix_row_t;
+#else
+typedef uint32_t matrix_row_t;
+#endif
+
+void matrix_init_custom(void);
+bool matrix_scan_custom(matrix_row_t current_matrix[]);
@@ -0,0 +1,51 @@
+//Host stand-in for the arm_atsam core's md_rgb_matrix.h, the globals and types it shares with the keyboard
+
+#pragma once
+
+#include <stdint.h>
+#include "quantum.h"
+
+typedef struct {
+    uint8_t addr;
+} issi3733_driver_t;
+
+//Massdrop configurator LED instructions
+#define LED_FLAG_NULL               0x00
+#define LED_FLAG_MATCH_ID           0x01
+#define LED_FLAG_MATCH_LAYER        0x02
+#define LED_FLAG_USE_RGB            0x10
+#define LED_FLAG_USE_PATTERN        0x20
+#define LED_FLAG_USE_ROTATE_PATTERN 0x40
+
+typedef struct {
+    unsigned short flags;
+    uint32_t id0;
+    uint32_t id1;
+    uint32_t id2;
+    uint32_t id3;
+    unsigned char layer;
+    unsigned char r;
+    unsigned char g;
+    unsigned char b;
+    unsigned char pattern_id;
+    unsigned char end;
+} led_instruction_t;
+
+#define LED_MODE_NORMAL             0
+#define LED_MODE_KEYS_ONLY          1
+#define LED_MODE_NON_KEYS_ONLY      2
+#define LED_MODE_INDICATORS_ONLY    3
+#define LED_MODE_MAX_INDEX          LED_MODE_INDICATORS_ONLY
+
+extern issi3733_driver_t issidrv[ISSI3733_DRIVER_COUNT];
+extern uint8_t gcr_desired;
+extern uint8_t gcr_actual;
+extern uint8_t gcr_actual_last;
+extern uint8_t gcr_breathe;
+extern uint8_t led_animation_breathing;
+extern uint8_t led_animation_id;
+extern uint8_t led_animation_direction;
+extern uint8_t led_animation_speed;
+extern uint8_t led_lighting_mode;
+extern uint8_t led_enabled;
+extern uint8_t led_setups_count;
@@ -0,0 +1,104 @@
+//Host stand-in for QMK's quantum.h, just what the keyboard sources use off the device
+//Keycodes and layer keys have their QMK values, the functions behind them are up to each test
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "timer.h"
+#include "keycode.h"
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define memcpy_P memcpy
+#define uprintf printf
+#define dprintf(...) do { if (debug_enable) printf(__VA_ARGS__); } while (0)
+
+typedef struct {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} RGB;
+
+typedef struct {
+    void (*init)(void);
+    void (*flush)(void);
+    void (*set_color)(int index, uint8_t r, uint8_t g, uint8_t b);
+    void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
+} rgb_matrix_driver_t;
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef struct {
+    keypos_t key;
+    bool pressed;
+    uint16_t time;
+} keyevent_t;
+
+typedef struct {
+    keyevent_t event;
+} keyrecord_t;
+
+typedef uint32_t layer_state_t;
+
+typedef union {
+    uint8_t raw;
+    struct {
+        bool num_lock : 1;
+        bool caps_lock : 1;
+        bool scroll_lock : 1;
+        bool compose : 1;
+        bool kana : 1;
+    };
+} led_t;
+
+typedef union {
+    uint16_t raw;
+    struct {
+        bool swap_control_capslock : 1;
+        bool capslock_to_control : 1;
+        bool swap_lalt_lgui : 1;
+        bool swap_ralt_rgui : 1;
+        bool no_gui : 1;
+        bool swap_grave_esc : 1;
+        bool swap_backslash_backspace : 1;
+        bool nkro : 1;
+    };
+} keymap_config_t;
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+extern keymap_config_t keymap_config;
+extern bool debug_enable;
+extern bool debug_matrix;
+extern bool debug_keyboard;
+extern bool debug_mouse;
+
+static inline uint8_t get_highest_layer(layer_state_t state) {
+    return state ? 31 - __builtin_clz(state) : 0;
+}
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
+bool process_record_user(uint16_t keycode, keyrecord_t *record);
+layer_state_t layer_state_set_user(layer_state_t state);
+layer_state_t default_layer_state_set_user(layer_state_t state);
+void matrix_init_user(void);
+void keyboard_post_init_kb(void);
+
+uint8_t get_mods(void);
+void set_mods(uint8_t mods);
+void register_code(uint8_t code);
+void unregister_code(uint8_t code);
+void add_key(uint8_t key);
+void del_key(uint8_t key);
+void send_keyboard_report(void);
+led_t host_keyboard_led_state(void);
+uint32_t eeconfig_read_kb(void);
+void reset_keyboard(void);
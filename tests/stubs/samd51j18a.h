@@ -0,0 +1,87 @@
+//Host stand-in for the SAMD51J18A device header, registers are plain memory the tests inspect
+//The cycle counter, the port and SERCOM2 are behind functions, so a test can move its simulated time on every read
+//and work the set/clear registers into the state they stand for before each access. The CMSIS interrupt functions
+//are left to the test, which decides when handlers run.
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    struct { uint16_t reg; } BTCNT;
+    struct { uint32_t reg; } SRCADDR;
+} DmacDescriptor;
+
+typedef struct {
+    struct {
+        struct { struct { uint8_t ENABLE; } bit; } CHCTRLA;
+    } Channel[1];
+} Dmac;
+
+typedef struct {
+    struct {
+        struct { uint32_t reg; } ADDR;
+    } I2CM;
+    struct {
+        struct { uint32_t reg; } DATA;
+        struct { uint8_t reg; } INTENCLR, INTENSET, INTFLAG;
+    } SPI;
+} Sercom;
+
+typedef struct {
+    struct { uint32_t reg; } DIR, DIRCLR, DIRSET, OUT, OUTCLR, OUTSET, IN, CTRL;
+    struct { uint8_t reg; } PINCFG[32];
+} PortGroup;
+
+typedef struct {
+    PortGroup Group[2];
+} Port;
+
+typedef struct {
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef enum {
+    SERCOM2_0_IRQn = 54,
+    SERCOM2_1_IRQn = 55,
+} IRQn_Type;
+
+extern Dmac mock_dmac;
+extern Sercom mock_sercom1;
+extern CoreDebug_Type mock_core_debug;
+DWT_Type *mock_dwt(void);
+Port *mock_port(void);
+Sercom *mock_sercom2(void);
+
+void __disable_irq(void);
+void __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+
+void SERCOM2_0_Handler(void);
+void SERCOM2_1_Handler(void);
+
+#define DMAC (&mock_dmac)
+#define SERCOM1 (&mock_sercom1)
+#define SERCOM2 (mock_sercom2())
+#define DWT (mock_dwt())
+#define PORT (mock_port())
+#define CoreDebug (&mock_core_debug)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk 1UL
+#define PORT_PINCFG_INEN 0x02
+#define PORT_PINCFG_PULLEN 0x04
+#define SERCOM_SPI_INTENCLR_DRE 0x01
+#define SERCOM_SPI_INTENCLR_TXC 0x02
+#define SERCOM_SPI_INTENCLR_MASK 0x8F
+#define SERCOM_SPI_INTENSET_DRE 0x01
+#define SERCOM_SPI_INTENSET_TXC 0x02
+#define SERCOM_SPI_INTFLAG_DRE 0x01
+#define SERCOM_SPI_INTFLAG_TXC 0x02
@@ -0,0 +1,35 @@
+//Host stand-in for the arm_atsam core's spi_master.h, the SR_EXP shift register the keyboard shares with it
+
+#pragma once
+
+#include <stdint.h>
+#include "samd51j18a.h"
+
+typedef union {
+    struct {
+        uint16_t RSVD4 : 1;
+        uint16_t RSVD5 : 1;
+        uint16_t RSVD6 : 1;
+        uint16_t SDB_N : 1;         //IS31FL3733 shutdown when 0
+        uint16_t IRST : 1;          //IS31FL3733 I2C reset when 1
+        uint16_t SRC_1 : 1;
+        uint16_t SRC_2 : 1;
+        uint16_t E_VBUS_1 : 1;
+        uint16_t E_VBUS_2 : 1;
+        uint16_t E_DN1_N : 1;
+        uint16_t S_DN1 : 1;
+        uint16_t E_UP_N : 1;
+        uint16_t S_UP : 1;
+        uint16_t HUB_CONNECT : 1;
+        uint16_t HUB_RESET_N : 1;   //USB hub reset when 0
+        uint16_t RSVD24 : 1;
+    } bit;
+    uint16_t reg;
+} Srdata_t;
+
+extern Srdata_t sr_exp_data;
+
+#define SR_EXP_RCLK_LO PORT->Group[SR_EXP_RCLK_PORT].OUTCLR.reg = (1 << SR_EXP_RCLK_PIN)
+#define SR_EXP_RCLK_HI PORT->Group[SR_EXP_RCLK_PORT].OUTSET.reg = (1 << SR_EXP_RCLK_PIN)
+
+void SR_EXP_WriteData(void);
@@ -0,0 +1,15 @@
+//Host stand-in for QMK's timer.h, time only moves when a test sets timer_ms
+
+#pragma once
+
+#include <stdint.h>
+
+extern uint32_t timer_ms;
+
+#define TIMER_DIFF_16(a, b) (uint16_t)((a) - (b))
+#define TIMER_DIFF_32(a, b) (uint32_t)((a) - (b))
+
+static inline uint16_t timer_read(void) { return (uint16_t)timer_ms; }
+static inline uint32_t timer_read32(void) { return timer_ms; }
+static inline uint16_t timer_elapsed(uint16_t last) { return TIMER_DIFF_16(timer_read(), last); }
+static inline uint32_t timer_elapsed32(uint32_t last) { return TIMER_DIFF_32(timer_read32(), last); }
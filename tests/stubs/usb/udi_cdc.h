@@ -0,0 +1,3 @@
+//Host stand-in for the arm_atsam core's CDC header, nothing of it is used off the device
+
+#pragma once
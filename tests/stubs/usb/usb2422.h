@@ -0,0 +1,7 @@
+//Host stand-in for the arm_atsam core's hub header, the LED settings it shares with the keyboard
+
+#pragma once
+
+#include <stdint.h>
+
+extern uint8_t usb_gcr_auto;